@@ -73,51 +73,45 @@ void setup()
 
 void loop()
 {
-    int raw = thermo.readRaw();
-    float voltage = thermo.readVoltage();
-    float tempC = thermo.readCelsius();
-    float tempF = thermo.readFahrenheit();
-    float tempK = thermo.readKelvin();
-    float filteredC = thermo.readFilteredTemperatureC(0.10);
-
     /**
-    * Basic sensor connection check
-    *
-    * - Checks whether the sensor output voltage is within a valid range.
-    * - Used only to indicate whether the sensor is likely connected or disconnected.
-    *
-    * Notes:
-    * - This check is based only on output voltage limits.
-    * - It does NOT detect exact fault types (open, short, reversed, etc.).
-    * - Use this only as a basic connection status indicator.
-    */
-    bool connected = thermo.FaultDetect();
+     * Single acquisition snapshot
+     *
+     * - read() samples the ADC once (averaged) and derives every value from it.
+     * - Calling readRaw(), readVoltage(), readCelsius(), ... separately would
+     *   repeat the averaged acquisition for each value.
+     *
+     * Sensor status:
+     * - m.status is the same check as FaultDetect(): output voltage within a valid range.
+     * - It does NOT detect exact fault types (open, short, reversed, etc.).
+     * - Use this only as a basic connection status indicator.
+     */
+    AD849x_7Semi::Measurement m = thermo.read(0.10);
 
     Serial.print("RAW: ");
-    Serial.print(raw);
+    Serial.print(m.raw);
 
     Serial.print(" | Voltage: ");
-    Serial.print(voltage, 3);
+    Serial.print(m.voltage, 3);
     Serial.print(" V");
 
     Serial.print(" | Temp: ");
-    Serial.print(tempC, 2);
+    Serial.print(m.celsius, 2);
     Serial.print(" °C");
 
     Serial.print(" | ");
-    Serial.print(tempF, 2);
+    Serial.print(m.fahrenheit, 2);
     Serial.print(" °F");
 
     Serial.print(" | ");
-    Serial.print(tempK, 2);
+    Serial.print(m.kelvin, 2);
     Serial.print(" K");
 
     Serial.print(" | Filtered: ");
-    Serial.print(filteredC, 2);
+    Serial.print(m.filtered, 2);
     Serial.print(" °C");
 
     Serial.print(" | Sensor: ");
-    Serial.println(connected ? "OK" : "FAULT");
+    Serial.println(m.status ? "OK" : "FAULT");
 
     delay(1000);
 }
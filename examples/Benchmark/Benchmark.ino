@@ -0,0 +1,123 @@
+/**
+ * 7Semi AD849x Conversion Benchmark
+ *
+ * - Measures the cost of converting ADC counts to temperature (no ADC reads).
+ * - Compares:
+ *   - rawToVoltage() + voltageToCelsius()  (two-step float math)
+ *   - rawToCelsius()                       (cached affine transform, one multiply-add)
+ *   - rawToMilliCelsius()                  (integer fixed-point path)
+ *   - AD849xStatic_7Semi::rawToCelsius()   (compile-time constants)
+ *   - AD849xStatic_7Semi::rawToMilliCelsius() (compile-time Q-format)
+ *   - rawToCelsius(src, dst, n)            (batch kernel, SIMD where available)
+ * - Also times one biquad low-pass update, float (AD849xBiquad_7Semi) versus
+ *   integer (AD849xBiquadFixed_7Semi), which matters on FPU-less MCUs.
+ *
+ * Notes:
+ * - No sensor is needed; conversions run on synthetic ADC codes.
+ * - Results are printed in µs per conversion (averaged over CONVERSIONS calls).
+ * - Differences are largest on FPU-less MCUs (AVR) where float division is expensive.
+ */
+
+#include <7Semi_AD849x.h>
+
+#define CONVERSIONS 2048
+#define BATCH 64
+
+AD849x_7Semi thermo;
+AD849xStatic_7Semi<A0, 5000, 1023, 1250, 5000> thermoStatic;
+AD849xBiquad_7Semi lowpass;
+AD849xBiquadFixed_7Semi lowpassFixed;
+
+/** Sinks keep the compiler from optimizing the loops away */
+volatile float sinkF;
+volatile int32_t sinkI;
+
+uint16_t batchIn[BATCH];
+float batchOut[BATCH];
+
+void printResult(const char *name, unsigned long us)
+{
+    Serial.print(name);
+    Serial.print(": ");
+    Serial.print((float)us / CONVERSIONS, 3);
+    Serial.println(" us/conversion");
+}
+
+void setup()
+{
+    Serial.begin(115200);
+
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+
+    thermoStatic.begin();
+
+    lowpass.setCutoffHz(1.0f, 100.0f);
+    lowpassFixed.setCutoffHz(1.0f, 100.0f);
+
+    for (int i = 0; i < BATCH; i++)
+    {
+        batchIn[i] = (i * 16) & 1023;
+    }
+
+    Serial.println("AD849x Conversion Benchmark");
+}
+
+void loop()
+{
+    unsigned long t0 = micros();
+    for (int i = 0; i < CONVERSIONS; i++)
+    {
+        sinkF = thermo.voltageToCelsius(thermo.rawToVoltage(i & 1023));
+    }
+    unsigned long t1 = micros();
+    for (int i = 0; i < CONVERSIONS; i++)
+    {
+        sinkF = thermo.rawToCelsius(i & 1023);
+    }
+    unsigned long t2 = micros();
+    for (int i = 0; i < CONVERSIONS; i++)
+    {
+        sinkI = thermo.rawToMilliCelsius(i & 1023);
+    }
+    unsigned long t3 = micros();
+    for (int i = 0; i < CONVERSIONS; i++)
+    {
+        sinkF = thermoStatic.rawToCelsius(i & 1023);
+    }
+    unsigned long t4 = micros();
+    for (int i = 0; i < CONVERSIONS; i += BATCH)
+    {
+        thermo.rawToCelsius(batchIn, batchOut, BATCH);
+        sinkF = batchOut[0];
+    }
+    unsigned long t5 = micros();
+    for (int i = 0; i < CONVERSIONS; i++)
+    {
+        sinkF = lowpass.update((float)(i & 1023));
+    }
+    unsigned long t6 = micros();
+    for (int i = 0; i < CONVERSIONS; i++)
+    {
+        sinkI = lowpassFixed.update((int32_t)(i & 1023) * 1000);
+    }
+    unsigned long t7 = micros();
+    for (int i = 0; i < CONVERSIONS; i++)
+    {
+        sinkI = thermoStatic.rawToMilliCelsius(i & 1023);
+    }
+    unsigned long t8 = micros();
+
+    printResult("rawToVoltage + voltageToCelsius", t1 - t0);
+    printResult("rawToCelsius (affine)          ", t2 - t1);
+    printResult("rawToMilliCelsius (fixed-point)", t3 - t2);
+    printResult("static rawToCelsius (constexpr)", t4 - t3);
+    printResult("static rawToMilliCelsius       ", t8 - t7);
+    printResult("batch rawToCelsius (kernel)    ", t5 - t4);
+    printResult("biquad update (float)          ", t6 - t5);
+    printResult("biquad update (fixed-point)    ", t7 - t6);
+    Serial.println();
+
+    delay(2000);
+}
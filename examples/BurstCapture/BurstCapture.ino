@@ -0,0 +1,66 @@
+/**
+ * 7Semi AD849x Burst Capture Example
+ *
+ * - Captures a dense burst of single ADC samples into a buffer (readRawBlock()).
+ * - Converts the whole burst to °C in one pass (convertBlock()).
+ * - Useful to look at fast transients, e.g. burner ignition.
+ *
+ * Wiring (Typical):
+ * - AD849x VOUT -> A0
+ * - AD849x VCC  -> 5V
+ * - AD849x GND  -> GND
+ *
+ * Notes:
+ * - Buffers are owned by the sketch; nothing is copied inside the library.
+ * - Samples are not averaged, expect more noise than readCelsius().
+ */
+
+#include <7Semi_AD849x.h>
+
+#define BURST_SAMPLES 128
+
+AD849x_7Semi thermo;
+
+uint16_t rawBurst[BURST_SAMPLES];
+float tempBurst[BURST_SAMPLES];
+
+void setup()
+{
+    Serial.begin(115200);
+
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+
+    Serial.println("AD849x Burst Capture Ready");
+}
+
+void loop()
+{
+    unsigned long t0 = micros();
+    thermo.readRawBlock(rawBurst, BURST_SAMPLES);
+    unsigned long t1 = micros();
+    thermo.convertBlock(rawBurst, tempBurst, BURST_SAMPLES);
+    unsigned long t2 = micros();
+
+    float tMin = tempBurst[0];
+    float tMax = tempBurst[0];
+
+    for (uint16_t i = 1; i < BURST_SAMPLES; i++)
+    {
+        if (tempBurst[i] < tMin) tMin = tempBurst[i];
+        if (tempBurst[i] > tMax) tMax = tempBurst[i];
+    }
+
+    Serial.print("Capture: ");
+    Serial.print(t1 - t0);
+    Serial.print(" us | Convert: ");
+    Serial.print(t2 - t1);
+    Serial.print(" us | Min: ");
+    Serial.print(tMin, 2);
+    Serial.print(" °C | Max: ");
+    Serial.print(tMax, 2);
+    Serial.println(" °C");
+
+    delay(1000);
+}
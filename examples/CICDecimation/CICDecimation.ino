@@ -0,0 +1,67 @@
+/**
+ * 7Semi AD849x CIC Decimation Example (AVR)
+ *
+ * - Free-running ADC on A0 at ~9.6 kS/s; every conversion goes through a
+ *   2nd-order CIC decimator inside the ADC interrupt (two 32-bit adds, no storage).
+ * - Ratio 1024 gives a new temperature ~9.4 times per second; 10 bits of input
+ *   plus 2 * 10 bits of growth (30 bits) fit the 32-bit registers.
+ * - The decimator output has extra precision: setOversampling(4) turns it into
+ *   14-bit effective counts, and readCelsius() converts them as usual.
+ *
+ * Wiring (Typical):
+ * - AD849x VOUT -> A0
+ * - AD849x VCC  -> 5V
+ * - AD849x GND  -> GND
+ *
+ * Notes:
+ * - AVR boards only (Uno, Nano, Mega, ...). On other MCUs call
+ *   thermo.pushSample(value) from your own ADC/timer ISR.
+ * - Do not call analogRead() anywhere while the ADC is free-running.
+ */
+
+#include <7Semi_AD849x.h>
+
+#if !defined(__AVR__)
+#error "This example uses AVR ADC registers. Call pushSample() from your own ISR on other MCUs."
+#endif
+
+AD849x_7Semi thermo;
+AD849xCIC_7Semi cic;
+
+/** Every conversion runs the CIC integrators; every 1024th also the combs */
+ISR(ADC_vect)
+{
+    thermo.pushSample(ADC);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+
+    /** 4 extra bits from the decimator's averaging */
+    thermo.setOversampling(4);
+
+    cic.configure(2, 1024);
+    thermo.setDecimator(&cic);
+
+    thermo.startFreeRunningADC(7);   // /128 prescaler, ~9.6 kS/s at 16 MHz
+
+    Serial.println("AD849x CIC Decimation Ready");
+}
+
+void loop()
+{
+    int raw = thermo.readRaw();
+
+    Serial.print("Raw (14-bit): ");
+    Serial.print(raw);
+    Serial.print(" | Temp: ");
+    Serial.print(thermo.rawToCelsius(raw), 3);
+    Serial.println(" °C");
+
+    delay(250);
+}
@@ -0,0 +1,90 @@
+/**
+ * 7Semi AD849x Filters Example
+ *
+ * - Smooths temperature with filter stages that keep their state between calls.
+ * - Each loop() does a short 4-sample readRaw() average; the filters supply the
+ *   long averaging horizon instead of a long blocking average.
+ * - Stages:
+ *   - AD849xMovingAverage_7Semi<N>: sliding mean, O(1) per update
+ *   - AD849xMedianFilter_7Semi<N>:  streaming median, removes single-sample spikes
+ *   - AD849xHampelFilter_7Semi<N>:  replaces only outliers (MAD test), passes clean
+ *                                   samples through unchanged
+ *   - AD849xKalman_7Semi:           temperature + rate Kalman filter; measurement
+ *                                   noise estimated from the ADC sample variance
+ *   - AD849xBiquad_7Semi:           2nd-order Butterworth low-pass, 40 dB/decade
+ *                                   (AD849xBiquadFixed_7Semi: integer-only version)
+ *
+ * Wiring (Typical):
+ * - AD849x VOUT -> A0
+ * - AD849x VCC  -> 5V
+ * - AD849x GND  -> GND
+ */
+
+#include <7Semi_AD849x.h>
+
+AD849x_7Semi thermo;
+
+/** 128-point sliding mean: 512 bytes of RAM */
+AD849xMovingAverage_7Semi<128> average;
+
+/** 5-point median and 7-point Hampel (3 sigma, ignore deviations below 0.5 °C) */
+AD849xMedianFilter_7Semi<5> median;
+AD849xHampelFilter_7Semi<7> hampel;
+
+/** Kalman filter with rate state: follows heating ramps without EMA lag */
+AD849xKalman_7Semi kalman;
+
+#define LOOP_MS 20
+
+/** 1 Hz Butterworth low-pass at the 50 Hz loop rate */
+AD849xBiquad_7Semi lowpass;
+
+void setup()
+{
+    Serial.begin(115200);
+
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+
+    /** Few ADC conversions per reading (>= 2 gives a noise estimate) */
+    thermo.setSampling(4);
+
+    hampel.setThreshold(3.0f, 0.5f);
+
+    kalman.setProcessNoise(0.01f);
+    kalman.setRateTracking(true);
+
+    lowpass.setCutoffHz(1.0f, 1000.0f / LOOP_MS);
+
+    Serial.println("AD849x Filters Ready");
+}
+
+void loop()
+{
+    float tempC = thermo.readCelsius();
+    float meanC = average.update(tempC);
+    float medianC = median.update(tempC);
+    float cleanC = hampel.update(tempC);
+    float kalmanC = kalman.update(tempC, LOOP_MS / 1000.0f, thermo.getMeasurementVarianceC());
+    float lowpassC = lowpass.update(tempC);
+
+    Serial.print("Raw: ");
+    Serial.print(tempC, 2);
+    Serial.print(" °C | Mean: ");
+    Serial.print(meanC, 2);
+    Serial.print(" °C | Median: ");
+    Serial.print(medianC, 2);
+    Serial.print(" °C | Hampel: ");
+    Serial.print(cleanC, 2);
+    Serial.print(hampel.isOutlier() ? " °C (spike)" : " °C");
+    Serial.print(" | Kalman: ");
+    Serial.print(kalmanC, 2);
+    Serial.print(" °C, ");
+    Serial.print(kalman.getRate(), 3);
+    Serial.print(" °C/s | Low-pass: ");
+    Serial.print(lowpassC, 2);
+    Serial.println(" °C");
+
+    delay(LOOP_MS);
+}
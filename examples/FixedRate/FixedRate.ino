@@ -0,0 +1,65 @@
+/**
+ * 7Semi AD849x Fixed-rate Sampling Example
+ *
+ * - Samples the sensor at a fixed rate using a micros() deadline scheduler.
+ * - No delay() in loop(): update() decides when the next sample is due.
+ * - Prints the measured inter-sample jitter once per second.
+ *
+ * Wiring (Typical):
+ * - AD849x VOUT -> A0
+ * - AD849x VCC  -> 5V
+ * - AD849x GND  -> GND
+ *
+ * Notes:
+ * - Filters and rate-of-change math assume uniform sample spacing;
+ *   jitter statistics show how uniform it really is.
+ */
+
+#include <7Semi_AD849x.h>
+
+AD849x_7Semi thermo;
+AD849xScheduler_7Semi pacer(thermo);
+
+unsigned long lastReport = 0;
+
+void setup()
+{
+    Serial.begin(115200);
+
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+    thermo.setSampling(10);
+
+    /** 20 samples per second */
+    pacer.setSampleRate(20);
+
+    Serial.println("AD849x Fixed-rate Sampling Ready");
+}
+
+void loop()
+{
+    /** Takes a snapshot only when the next deadline is reached */
+    pacer.update(0.10);
+
+    if (millis() - lastReport >= 1000)
+    {
+        lastReport = millis();
+
+        AD849x_7Semi::Measurement m = pacer.getMeasurement();
+        AD849xScheduler_7Semi::JitterStats j = pacer.getJitterStats();
+
+        Serial.print("Temp: ");
+        Serial.print(m.celsius, 2);
+        Serial.print(" °C | Filtered: ");
+        Serial.print(m.filtered, 2);
+        Serial.print(" °C | Jitter min/mean/max: ");
+        Serial.print(j.minUs);
+        Serial.print(" / ");
+        Serial.print(j.meanUs, 1);
+        Serial.print(" / ");
+        Serial.print(j.maxUs);
+        Serial.print(" us | Missed: ");
+        Serial.println(j.missed);
+    }
+}
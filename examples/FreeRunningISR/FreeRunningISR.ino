@@ -0,0 +1,68 @@
+/**
+ * 7Semi AD849x Free-running ADC Example (AVR)
+ *
+ * - Runs the AVR ADC in free-running mode on A0.
+ * - The ADC interrupt pushes every conversion into the library ring buffer.
+ * - readCelsius() then averages buffered samples instead of calling analogRead().
+ *
+ * Wiring (Typical):
+ * - AD849x VOUT -> A0
+ * - AD849x VCC  -> 5V
+ * - AD849x GND  -> GND
+ *
+ * Notes:
+ * - AVR boards only (Uno, Nano, Mega, ...).
+ * - Do not call analogRead() anywhere while the ADC is free-running.
+ * - On other MCUs, call thermo.pushSample(value) from your own ADC/timer ISR.
+ */
+
+#include <7Semi_AD849x.h>
+
+#if !defined(__AVR__)
+#error "This example uses AVR ADC registers. Call pushSample() from your own ISR on other MCUs."
+#endif
+
+AD849x_7Semi thermo;
+
+/** Ring buffer storage: power of two, holds up to 31 samples */
+uint16_t samples[32];
+
+/** Every finished conversion lands in the ring buffer */
+ISR(ADC_vect)
+{
+    thermo.pushSample(ADC);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+
+    /** Average the newest 16 buffered samples per reading */
+    thermo.setSampling(16);
+
+    thermo.setBuffer(samples, 32);
+    thermo.setBufferedMode(true);
+    thermo.startFreeRunningADC(7);   // /128 prescaler, ~9.6 kS/s at 16 MHz
+
+    Serial.println("AD849x Free-running Reader Ready");
+}
+
+void loop()
+{
+    float tempC = thermo.readCelsius();
+    float filteredC = thermo.readFilteredTemperatureC(0.10);
+
+    Serial.print("Temp: ");
+    Serial.print(tempC, 2);
+    Serial.print(" °C");
+
+    Serial.print(" | Filtered: ");
+    Serial.print(filteredC, 2);
+    Serial.println(" °C");
+
+    delay(500);
+}
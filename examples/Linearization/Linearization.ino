@@ -0,0 +1,54 @@
+/**
+ * 7Semi AD849x Thermocouple Linearization Example
+ *
+ * - Compares the plain linear 5mV/°C conversion with NIST ITS-90 linearization.
+ * - The linear estimate drifts by several degrees at high temperatures;
+ *   the linearized value follows the thermocouple's real curve.
+ *
+ * Wiring (Typical):
+ * - AD849x VOUT -> A0
+ * - AD849x VCC  -> 5V
+ * - AD849x GND  -> GND
+ *
+ * Notes:
+ * - setAmplifierGain() must match the IC: AD8495/AD8497 (K) 122.4, AD8494/AD8496 (J) 96.7.
+ * - Select the thermocouple type actually connected (K, J, T, E or N).
+ */
+
+#include <7Semi_AD849x.h>
+
+AD849x_7Semi thermo;
+
+void setup()
+{
+    Serial.begin(115200);
+
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+    thermo.setAmplifierGain(122.4);    // AD8495
+
+    Serial.println("AD849x Linearization Ready");
+}
+
+void loop()
+{
+    int raw = thermo.readRaw();
+
+    thermo.setThermocoupleType(AD849X_TYPE_LINEAR);
+    float linearC = thermo.rawToCelsius(raw);
+
+    thermo.setThermocoupleType(AD849X_TYPE_K);
+    float nistC = thermo.rawToCelsius(raw);
+    int32_t nistMilliC = thermo.rawToMilliCelsius(raw);
+
+    Serial.print("Linear: ");
+    Serial.print(linearC, 2);
+    Serial.print(" °C | NIST K: ");
+    Serial.print(nistC, 2);
+    Serial.print(" °C | NIST K (fixed-point): ");
+    Serial.print(nistMilliC);
+    Serial.println(" m°C");
+
+    delay(1000);
+}
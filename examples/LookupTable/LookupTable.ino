@@ -0,0 +1,59 @@
+/**
+ * 7Semi AD849x Lookup Table Example
+ *
+ * - Builds a raw-code -> °C table so each conversion is a single indexed load.
+ * - Prints the table as a PROGMEM array that can be pasted into a sketch
+ *   with a fixed configuration (then attach it with setLookupTableP()).
+ *
+ * Wiring (Typical):
+ * - AD849x VOUT -> A0
+ * - AD849x VCC  -> 5V
+ * - AD849x GND  -> GND
+ *
+ * Notes:
+ * - A RAM table needs 4 bytes per ADC code (4 KB for 10-bit, 16 KB for 12-bit).
+ *   Use setLookupTable() on boards with enough RAM (ESP32, SAMD, RP2040, ...).
+ * - On AVR, generate the table once (this sketch only prints it, no RAM table
+ *   is kept) and store it in flash with PROGMEM + setLookupTableP().
+ */
+
+#include <7Semi_AD849x.h>
+
+AD849x_7Semi thermo;
+
+void setup()
+{
+    Serial.begin(115200);
+
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+
+    /** Print the table for the current configuration, 8 codes per line */
+    Serial.println("const float ad849xTable[1024] PROGMEM = {");
+
+    /** No table attached yet, so rawToCelsius() evaluates the full conversion */
+    for (uint16_t code = 0; code < 1024; code += 8)
+    {
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            Serial.print(thermo.rawToCelsius(code + i), 4);
+            Serial.print(code + i < 1023 ? ", " : "");
+        }
+        Serial.println();
+    }
+
+    Serial.println("};");
+    Serial.println();
+    Serial.println("Attach in your sketch with: thermo.setLookupTableP(ad849xTable, 1024);");
+}
+
+void loop()
+{
+    /** Same values as the printed table (computed, since no table is attached here) */
+    Serial.print("Temp: ");
+    Serial.print(thermo.readCelsius(), 2);
+    Serial.println(" °C");
+
+    delay(1000);
+}
@@ -0,0 +1,65 @@
+/**
+ * 7Semi AD849x Multi-channel Example
+ *
+ * - Scans several AD849x outputs with one AD849xArray_7Semi object.
+ * - step() does one ADC conversion per call (round-robin over channels),
+ *   so the scan can be interleaved with other work in loop().
+ * - All channels are converted together when a scan completes.
+ *
+ * Wiring (Typical):
+ * - AD849x #0 VOUT -> A0
+ * - AD849x #1 VOUT -> A1
+ * - AD849x #2 VOUT -> A2
+ * - AD849x #3 VOUT -> A3
+ * - All modules: VCC -> 5V, GND -> GND
+ *
+ * Notes:
+ * - Offset voltage and sensitivity can be set per channel.
+ */
+
+#include <7Semi_AD849x.h>
+
+#define CHANNELS 4
+
+const uint8_t pins[CHANNELS] = {A0, A1, A2, A3};
+
+AD849xArray_7Semi<CHANNELS> rack;
+
+unsigned long lastPrint = 0;
+
+void setup()
+{
+    Serial.begin(115200);
+
+    rack.begin(pins, 5.00, 1023);
+
+    for (uint8_t ch = 0; ch < CHANNELS; ch++)
+    {
+        rack.setOffsetVoltage(ch, 1.25);
+        rack.setSensitivity(ch, 0.005);
+    }
+
+    rack.setSampling(10);
+    rack.setFilterAlpha(0.2);
+
+    Serial.println("AD849x Multi-channel Scanner Ready");
+}
+
+void loop()
+{
+    /** One conversion per pass; true when every channel has a new value */
+    if (rack.step() && millis() - lastPrint >= 1000)
+    {
+        lastPrint = millis();
+
+        for (uint8_t ch = 0; ch < CHANNELS; ch++)
+        {
+            Serial.print("CH");
+            Serial.print(ch);
+            Serial.print(": ");
+            Serial.print(rack.getFiltered(ch), 2);
+            Serial.print(" °C  ");
+        }
+        Serial.println();
+    }
+}
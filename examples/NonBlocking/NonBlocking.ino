@@ -0,0 +1,65 @@
+/**
+ * 7Semi AD849x Non-blocking Example
+ *
+ * - Reads the AD849x output without stalling loop().
+ * - startConversion(true) starts continuous averaging windows.
+ * - poll() takes one ADC sample per call and returns immediately.
+ * - available() / getConversion() hand over each finished average.
+ *
+ * Wiring (Typical):
+ * - AD849x VOUT -> A0
+ * - AD849x VCC  -> 5V
+ * - AD849x GND  -> GND
+ *
+ * Notes:
+ * - Other work in loop() (serial handling, control code) keeps running
+ *   while the averaging window fills up.
+ */
+
+#include <7Semi_AD849x.h>
+
+AD849x_7Semi thermo;
+
+unsigned long loopCount = 0;
+
+void setup()
+{
+    Serial.begin(115200);
+
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+
+    /** 64 samples per result, taken one per loop() pass */
+    thermo.setSampling(64);
+
+    /** Continuous mode: a new window starts after every result */
+    thermo.startConversion(true);
+
+    Serial.println("AD849x Non-blocking Reader Ready");
+}
+
+void loop()
+{
+    /** One ADC sample, never more */
+    thermo.poll();
+
+    if (thermo.available())
+    {
+        int raw = thermo.getConversion();
+        float tempC = thermo.voltageToCelsius(thermo.rawToVoltage(raw));
+
+        Serial.print("RAW: ");
+        Serial.print(raw);
+        Serial.print(" | Temp: ");
+        Serial.print(tempC, 2);
+        Serial.print(" °C");
+        Serial.print(" | loop() passes: ");
+        Serial.println(loopCount);
+
+        loopCount = 0;
+    }
+
+    /** Other application work keeps running here */
+    loopCount++;
+}
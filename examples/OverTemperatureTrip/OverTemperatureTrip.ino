@@ -0,0 +1,76 @@
+/**
+ * 7Semi AD849x Over-temperature Trip Example
+ *
+ * - Converts alarm thresholds to ADC counts once with celsiusToRaw().
+ * - Per reading, the alarm is an integer compare on readRaw(): no float math.
+ * - setOverTemperatureTrip() runs the same compare on every pushSample(),
+ *   so a heater can be cut from inside the ADC interrupt; it trips after
+ *   3 consecutive samples over the limit (setTripDebounce()), so one noise
+ *   spike cannot cut the heater.
+ *
+ * Wiring (Typical):
+ * - AD849x VOUT -> A0
+ * - Heater relay / SSR -> pin 7 (HIGH = heater on)
+ *
+ * Notes:
+ * - The trip latches; call resetTrip() after the fault is handled.
+ * - Thresholds must be recomputed after configuration changes;
+ *   the trip threshold is updated automatically.
+ */
+
+#include <7Semi_AD849x.h>
+
+#define HEATER_PIN 7
+
+AD849x_7Semi thermo;
+
+int32_t warnRaw;
+
+/** Runs once when the trip fires (possibly inside an ISR): keep it short */
+void heaterOff(void *context)
+{
+    (void)context;
+    digitalWrite(HEATER_PIN, LOW);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+
+    pinMode(HEATER_PIN, OUTPUT);
+    digitalWrite(HEATER_PIN, HIGH);
+
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+
+    /** Soft warning at 80 °C, hard trip at 95 °C */
+    warnRaw = thermo.celsiusToRaw(80.0f);
+    thermo.setOverTemperatureTrip(95.0f, heaterOff);
+
+    Serial.print("Warn at raw >= ");
+    Serial.print(warnRaw);
+    Serial.print(", trip at raw >= ");
+    Serial.println(thermo.getTripRaw());
+}
+
+void loop()
+{
+    int raw = thermo.readRaw();
+
+    if (thermo.isTripped())
+    {
+        Serial.println("TRIPPED: heater off");
+    }
+    else if (raw >= warnRaw)
+    {
+        Serial.println("Warning: above 80 C");
+    }
+    else
+    {
+        Serial.print("Raw: ");
+        Serial.println(raw);
+    }
+
+    delay(250);
+}
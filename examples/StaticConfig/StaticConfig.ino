@@ -0,0 +1,83 @@
+/**
+ * 7Semi AD849x Compile-time Configuration Example
+ *
+ * - Same output as the Basic example, using AD849xStatic_7Semi.
+ * - Pin, Vref, ADC max count, offset voltage and sensitivity are template
+ *   arguments, so conversion constants are folded in at compile time.
+ *
+ * Wiring (Typical):
+ * - AD849x VOUT -> A0
+ * - AD849x VCC  -> 5V
+ * - AD849x GND  -> GND
+ *
+ * Flash / speed comparison:
+ * - Build once with USE_STATIC 1 and once with USE_STATIC 0 (same sketch,
+ *   runtime-configured AD849x_7Semi) for the same board and compare the
+ *   "Sketch uses ... bytes" lines reported by the IDE.
+ * - Run the Benchmark example to compare per-conversion time.
+ *
+ * Notes:
+ * - Template values are integers: Vref and offset in mV, sensitivity in µV/°C.
+ * - AD849xStatic_7Semi covers the reading API only; see its header comment
+ *   for what is not supported (linearization, curves, ISR modes, ...).
+ */
+
+#include <7Semi_AD849x.h>
+
+#define USE_STATIC 1
+
+#if USE_STATIC
+/** A0, Vref 5000 mV, 10-bit ADC, 1250 mV offset, 5000 µV/°C */
+AD849xStatic_7Semi<A0, 5000, 1023, 1250, 5000> thermo;
+#else
+AD849x_7Semi thermo;
+#endif
+
+void setup()
+{
+    Serial.begin(115200);
+
+#if USE_STATIC
+    thermo.begin();
+#else
+    thermo.begin(A0, 5.00, 1023);
+    thermo.setOffsetVoltage(1.25);
+    thermo.setSensitivity(0.005);
+#endif
+    thermo.setSampling(10);
+
+    Serial.println("AD849x (compile-time configuration) Ready");
+}
+
+void loop()
+{
+    AD849x_7Semi::Measurement m = thermo.read(0.10);
+
+    Serial.print("RAW: ");
+    Serial.print(m.raw);
+
+    Serial.print(" | Voltage: ");
+    Serial.print(m.voltage, 3);
+    Serial.print(" V");
+
+    Serial.print(" | Temp: ");
+    Serial.print(m.celsius, 2);
+    Serial.print(" °C");
+
+    Serial.print(" | ");
+    Serial.print(m.fahrenheit, 2);
+    Serial.print(" °F");
+
+    Serial.print(" | ");
+    Serial.print(m.kelvin, 2);
+    Serial.print(" K");
+
+    Serial.print(" | Filtered: ");
+    Serial.print(m.filtered, 2);
+    Serial.print(" °C");
+
+    Serial.print(" | Sensor: ");
+    Serial.println(m.status ? "OK" : "FAULT");
+
+    delay(1000);
+}
@@ -0,0 +1,52 @@
+/**
+ * 7Semi AD849x host test helpers
+ *
+ * - Minimal CHECK macros; each test_*.cpp is its own program.
+ * - A failed CHECK prints file:line and the expression; main() returns
+ *   TEST_RESULT() so make stops on the first failing test program.
+ * - Every conversion comes from test_adc (AD849xMockADC_7Semi) through the
+ *   ad849xReadADC() hook; it returns 0 until a test sets a value.
+ */
+
+#ifndef _7SEMI_AD849X_TEST_H_
+#define _7SEMI_AD849X_TEST_H_
+
+#include <stdio.h>
+#include <math.h>
+#include "7Semi_AD849x.h"
+
+static int test_failures = 0;
+
+static AD849xMockADC_7Semi test_adc;
+
+uint16_t ad849xReadADC(uint8_t pin)
+{
+    return test_adc.read(pin);
+}
+
+#define CHECK(expr)                                                    \
+    do                                                                 \
+    {                                                                  \
+        if (!(expr))                                                   \
+        {                                                              \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            test_failures++;                                           \
+        }                                                              \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, tol)                              \
+    do                                                                 \
+    {                                                                  \
+        double a_ = (actual), e_ = (expected);                         \
+        if (!(fabs(a_ - e_) <= (tol)))                                 \
+        {                                                              \
+            printf("%s:%d: %s = %.6f, expected %.6f +/- %g\n",         \
+                   __FILE__, __LINE__, #actual, a_, e_, (double)(tol)); \
+            test_failures++;                                           \
+        }                                                              \
+    } while (0)
+
+#define TEST_RESULT()                                                  \
+    (printf("%s: %s\n", __FILE__, test_failures ? "FAILED" : "passed"), test_failures ? 1 : 0)
+
+#endif
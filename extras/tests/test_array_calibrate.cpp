@@ -0,0 +1,40 @@
+/**
+ * AD849xArray_7Semi::calibrate()
+ * - A second calibration against the same reference must keep the channel
+ *   on the reference (offset accumulates, it is not replaced).
+ * - Other channels are untouched.
+ */
+
+#include "ad849x_test.h"
+
+int main()
+{
+    const uint8_t pins[2] = {0, 1};
+    AD849xArray_7Semi<2> rack;
+
+    rack.begin(pins, 5.0f, 1023);
+    rack.setSampling(4);
+
+    test_adc.setValue(512);                 // ~250.5 °C uncalibrated
+    rack.scan();
+    float uncalibrated = rack.getCelsius(1);
+
+    rack.calibrate(0, 30.0f);
+    rack.scan();
+    CHECK_NEAR(rack.getCelsius(0), 30.0f, 0.01f);
+
+    /** Second call with the same reference must not undo the first */
+    rack.calibrate(0, 30.0f);
+    rack.scan();
+    CHECK_NEAR(rack.getCelsius(0), 30.0f, 0.01f);
+
+    /** Calibrating twice without a scan in between */
+    rack.calibrate(0, 40.0f);
+    rack.calibrate(0, 40.0f);
+    rack.scan();
+    CHECK_NEAR(rack.getCelsius(0), 40.0f, 0.01f);
+
+    CHECK_NEAR(rack.getCelsius(1), uncalibrated, 0.001f);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,52 @@
+/**
+ * AD849xArray_7Semi per-channel thermocouple type and gain
+ * - A rack mixing AD8494 (J) and AD8495 (K) channels linearizes each channel
+ *   with its own NIST table and amplifier gain, matching a single
+ *   AD849x_7Semi configured with the same device.
+ * - Linear channels stay on the plain 5 mV/°C transfer.
+ */
+
+#include "ad849x_test.h"
+
+int main()
+{
+    const uint8_t pins[3] = {0, 1, 2};
+    AD849xArray_7Semi<3> rack;
+
+    rack.begin(pins, 5.0f, 1023);
+    rack.setSampling(1);
+    CHECK(rack.setDevice(0, AD8494_J));
+    CHECK(rack.setDevice(1, AD8495_K));
+    CHECK(!rack.setDevice(3, AD8495_K));
+    CHECK(!rack.setDevice(2, AD849X_DEVICE_COUNT));
+
+    AD849x_7Semi j;
+    AD849x_7Semi k;
+    j.begin(0, 5.0f, 1023);
+    k.begin(1, 5.0f, 1023);
+    j.setDevice(AD8494_J);
+    k.setDevice(AD8495_K);
+
+    test_adc.setValue(700);                 // ~3.42 V: a few hundred °C
+    rack.scan();
+
+    CHECK_NEAR(rack.getCelsius(0), j.rawToCelsius(700), 0.05f);
+    CHECK_NEAR(rack.getCelsius(1), k.rawToCelsius(700), 0.05f);
+    CHECK(fabs(rack.getCelsius(0) - rack.getCelsius(1)) > 1.0f);
+    CHECK_NEAR(rack.getCelsius(2), (700 * 5.0f / 1023 - 1.25f) / 0.005f, 0.01f);
+
+    /** Per-channel gain override affects only that channel */
+    float before = rack.getCelsius(0);
+    rack.setAmplifierGain(1, 100.0f);
+    rack.scan();
+    CHECK_NEAR(rack.getCelsius(0), before, 0.001f);
+    CHECK(fabs(rack.getCelsius(1) - k.rawToCelsius(700)) > 1.0f);
+
+    /** Global setter still sets every channel */
+    rack.setThermocoupleType(AD849X_TYPE_LINEAR);
+    rack.scan();
+    CHECK_NEAR(rack.getCelsius(0), rack.getCelsius(2), 0.001f);
+    CHECK_NEAR(rack.getCelsius(1), rack.getCelsius(2), 0.001f);
+
+    return TEST_RESULT();
+}
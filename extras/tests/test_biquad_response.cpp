@@ -0,0 +1,94 @@
+/**
+ * AD849xBiquad_7Semi / AD849xBiquadFixed_7Semi frequency response
+ * - Steady-state sine sweep, gain measured by I/Q projection over whole
+ *   periods after the transient has settled.
+ * - Both versions must match the bilinear Butterworth curve and
+ *   responseDb() at fc (-3.01 dB), 2 * fc and the 50 / 60 Hz mains bins.
+ */
+
+#include "ad849x_test.h"
+
+static const float FC = 1.0f;
+static const float FS = 1000.0f;
+static const uint32_t SETTLE = 5000;            // 5 s, >> 1 / fc
+static const uint32_t MEASURE = 1000;           // 1 s: whole periods of every test tone
+static const double AMPLITUDE = 1048576.0;      // 2^20 counts, inside the fixed-point input range
+
+static double analyticDb(double f)
+{
+    double r = tan(M_PI * f / FS) / tan(M_PI * FC / FS);
+    return -10.0 * log10(1.0 + r * r * r * r);
+}
+
+static double gainDb(double i, double q)
+{
+    return 20.0 * log10(sqrt(i * i + q * q) * 2.0 / MEASURE / AMPLITUDE);
+}
+
+static double floatResponseDb(double f)
+{
+    AD849xBiquad_7Semi lp;
+    lp.setCutoffHz(FC, FS);
+
+    double i = 0, q = 0;
+    for (uint32_t n = 0; n < SETTLE + MEASURE; n++)
+    {
+        double phase = 2.0 * M_PI * f * n / FS;
+        float y = lp.update((float)(AMPLITUDE * sin(phase)));
+
+        if (n >= SETTLE)
+        {
+            i += y * sin(phase);
+            q += y * cos(phase);
+        }
+    }
+    return gainDb(i, q);
+}
+
+static double fixedResponseDb(double f)
+{
+    AD849xBiquadFixed_7Semi lp;
+    lp.setCutoffHz(FC, FS);
+
+    double i = 0, q = 0;
+    for (uint32_t n = 0; n < SETTLE + MEASURE; n++)
+    {
+        double phase = 2.0 * M_PI * f * n / FS;
+        int32_t y = lp.update((int32_t)lround(AMPLITUDE * sin(phase)));
+
+        if (n >= SETTLE)
+        {
+            i += y * sin(phase);
+            q += y * cos(phase);
+        }
+    }
+    return gainDb(i, q);
+}
+
+static void checkTone(double f, double expectedDb, double tolDb)
+{
+    AD849xBiquad_7Semi lp;
+    lp.setCutoffHz(FC, FS);
+
+    CHECK_NEAR(analyticDb(f), expectedDb, 0.05);
+    CHECK_NEAR(lp.responseDb(f), analyticDb(f), 0.01);
+    CHECK_NEAR(floatResponseDb(f), analyticDb(f), tolDb);
+    CHECK_NEAR(fixedResponseDb(f), analyticDb(f), tolDb);
+}
+
+int main()
+{
+    checkTone(FC, -3.01, 0.01);
+    checkTone(2 * FC, -12.30, 0.01);
+    checkTone(50.0, -68.10, 0.02);
+    checkTone(60.0, -71.33, 0.02);
+
+    /** DC passes with unity gain */
+    AD849xBiquadFixed_7Semi lp;
+    lp.setCutoffHz(FC, FS);
+    int32_t y = 0;
+    for (uint32_t n = 0; n < SETTLE; n++) y = lp.update(12345);
+    CHECK(y == 12345);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,74 @@
+/**
+ * AD849x_7Semi buffered (ISR) acquisition with a caller-owned ring buffer
+ * - setBuffer() accepts only power-of-two sizes 2 .. 128.
+ * - Without a buffer pushSample() drops samples and readRaw() keeps its result.
+ * - A full buffer keeps the newest size - 1 samples; readRaw() averages the
+ *   newest min(window, buffered) and drains the buffer.
+ * - Windows longer than one internal copy chunk (16) sum correctly.
+ * - setOversampling() is capped so 4^n fits the buffer (size - 1 samples)
+ *   and restored when buffered mode is left.
+ */
+
+#include "ad849x_test.h"
+
+int main()
+{
+    static uint16_t samples[64];
+    AD849x_7Semi thermo;
+
+    thermo.begin(0, 5.0f, 1023);
+    thermo.setSampling(4);
+    thermo.setBufferedMode(true);
+
+    /** No buffer: nothing stored */
+    thermo.pushSample(500);
+    CHECK(thermo.bufferedCount() == 0);
+    CHECK(thermo.readRaw() == 0);
+
+    /** Size validation */
+    CHECK(!thermo.setBuffer(samples, 0));
+    CHECK(!thermo.setBuffer(samples, 1));
+    CHECK(!thermo.setBuffer(samples, 24));
+    CHECK(thermo.setBuffer(samples, 8));
+
+    /** Overflow keeps the newest 7: 13..19 */
+    for (uint16_t i = 0; i < 20; i++) thermo.pushSample(100 + i);
+    CHECK(thermo.bufferedCount() == 7);
+
+    /** Window 4 -> (119 + 118 + 117 + 116) / 4, truncated; buffer drained */
+    CHECK(thermo.readRaw() == 117);
+    CHECK(thermo.getLastSampleCount() == 4);
+    CHECK(thermo.bufferedCount() == 0);
+
+    /** Nothing new: previous result kept */
+    CHECK(thermo.readRaw() == 117);
+
+    /** 40 samples over several chunks */
+    CHECK(thermo.setBuffer(samples, 64));
+    thermo.setSampling(40);
+    for (uint16_t i = 0; i < 40; i++) thermo.pushSample(i & 1 ? 210 : 200);
+    CHECK(thermo.readRaw() == 205);
+    CHECK(thermo.getLastSampleCount() == 40);
+    CHECK_NEAR(thermo.getSampleVariance(), 25.0 * 40 / 39, 0.01);
+
+    /** Oversampling: 4^n must fit the ring */
+    thermo.setOversampling(5);
+    CHECK(thermo.getOversampling() == 2);          // 16 <= 63
+    CHECK(thermo.getEffectiveResolution() == 1023 << 2);
+    CHECK(thermo.setBuffer(samples, 8));
+    CHECK(thermo.getOversampling() == 1);          // 4 <= 7
+    for (uint16_t i = 0; i < 4; i++) thermo.pushSample(300);
+    CHECK(thermo.readRaw() == 600);
+    CHECK(thermo.getLastSampleCount() == 4);
+    thermo.setBufferedMode(false);
+    CHECK(thermo.getOversampling() == 5);
+    thermo.setBufferedMode(true);
+    thermo.setOversampling(0);
+
+    /** Detach */
+    CHECK(thermo.setBuffer(nullptr, 0));
+    thermo.pushSample(900);
+    CHECK(thermo.bufferedCount() == 0);
+
+    return TEST_RESULT();
+}
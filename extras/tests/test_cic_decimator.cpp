@@ -0,0 +1,97 @@
+/**
+ * AD849xCIC_7Semi with AD849x_7Semi::setDecimator()
+ * - Constant input decimates exactly for power-of-two and other ratios.
+ * - readRaw() returns the normalized output in effective counts; before the
+ *   first output it returns the latest single sample, not 0.
+ * - configure() rejects orders / ratios whose bit growth would overflow the
+ *   32-bit registers for the given input width.
+ * - setDecimator() rejects a CIC sized for fewer bits than the ADC delivers.
+ */
+
+#include "ad849x_test.h"
+
+int main()
+{
+    AD849xCIC_7Semi cic;
+    AD849x_7Semi thermo;
+
+    thermo.begin(0, 5.0f, 1023);
+    thermo.setOversampling(4);
+
+    /** Non power-of-two ratio: gain removed by division in readRaw() */
+    CHECK(cic.configure(2, 1000));
+    CHECK(thermo.setDecimator(&cic));
+
+    /** Start-up: latest single sample until the first CIC output */
+    thermo.pushSample(690);
+    thermo.pushSample(701);
+    CHECK(thermo.readRaw() == 701 << 4);
+    CHECK(thermo.getLastSampleCount() == 1);
+
+    for (uint32_t i = 0; i < 5000; i++)
+    {
+        thermo.pushSample(700);
+    }
+
+    CHECK(thermo.readRaw() == 700 << 4);
+    CHECK(thermo.getLastSampleCount() == 1000);
+
+    /** Full-scale input with the widest allowed growth (10 + 2 * 11 = 32 bits) */
+    CHECK(cic.configure(2, 2000));
+    for (uint32_t i = 0; i < 8000; i++)
+    {
+        thermo.pushSample(1023);
+    }
+
+    CHECK(thermo.readRaw() == 1023 << 4);
+
+    /** Power-of-two ratio: shift */
+    CHECK(cic.configure(2, 1024));
+    for (uint32_t i = 0; i < 4096; i++)
+    {
+        thermo.pushSample(300);
+    }
+
+    CHECK(thermo.readRaw() == 300 << 4);
+
+    /** Standalone: normalize() of the latched raw output matches read() */
+    CHECK(cic.normalize(cic.rawOutput(), 0) == cic.read(0));
+    CHECK(cic.read(0) == 300);
+
+    /** Rounding of the fraction on the division path */
+    CHECK(cic.configure(1, 3));
+    for (uint32_t i = 0; i < 3; i++) cic.push(i == 0 ? 1 : 0);
+    cic.push(0);
+    cic.push(1);
+    cic.push(1);
+    CHECK(cic.read(0) == 1);                // 2 / 3 -> 1
+    CHECK(cic.read(2) == 3);                // 2 / 3 * 4 = 2.67 -> 3
+
+    /** Register width and range limits (10-bit input by default) */
+    CHECK(cic.configure(4, 32));
+    CHECK(!cic.configure(4, 33));
+    CHECK(cic.configure(3, 128));
+    CHECK(!cic.configure(3, 129));
+    CHECK(cic.configure(2, 2048));
+    CHECK(!cic.configure(2, 2049));
+    CHECK(cic.configure(1, 1UL << 22));
+    CHECK(!cic.configure(1, (1UL << 22) + 1));
+    CHECK(cic.configure(1, 0x80000000UL, 1));
+    CHECK(!cic.configure(1, 0x80000001UL, 1));
+    CHECK(!cic.configure(1, 0xFFFFFFFFUL, 1));
+    CHECK(!cic.configure(3, 128, 12));
+    CHECK(!cic.configure(1, 2, 17));
+    CHECK(!cic.configure(5, 2));
+    CHECK(!cic.configure(1, 0));
+    CHECK(cic.getOrder() == 1 && cic.getRatio() == 0x80000000UL);
+
+    /** 12-bit ADC needs a CIC configured for 12-bit input */
+    AD849x_7Semi wide;
+    wide.begin(0, 3.3f, 4095);
+    CHECK(cic.configure(2, 1024));
+    CHECK(!wide.setDecimator(&cic));
+    CHECK(cic.configure(2, 1024, 12));
+    CHECK(wide.setDecimator(&cic));
+
+    return TEST_RESULT();
+}
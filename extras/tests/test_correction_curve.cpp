@@ -0,0 +1,65 @@
+/**
+ * Correction curve: integer m°C path vs float path
+ * - Steep segments (corrections changing by up to ~300 °C per segment) must
+ *   not overflow the fixed-point interpolation.
+ * - Uniform and non-uniform grids, inside and beyond the grid ends.
+ * - Uniform: a fine 300-point grid with a non-power-of-two step (index
+ *   estimate from the 16-bit reciprocal must land on the right segment).
+ * - Non-uniform with and without the reciprocals workspace.
+ */
+
+#include "ad849x_test.h"
+
+static float worstDifference(AD849x_7Semi &thermo)
+{
+    float worst = 0;
+
+    for (int raw = 0; raw <= 4095; raw++)
+    {
+        float exact = thermo.rawToCelsius(raw) * 1000.0f;
+        float fixed = (float)thermo.rawToMilliCelsius(raw);
+        float diff = fabsf(exact - fixed);
+        if (diff > worst) worst = diff;
+    }
+
+    return worst;
+}
+
+int main()
+{
+    AD849x_7Semi thermo;
+    thermo.begin(0, 3.3f, 4095);
+    thermo.setOffsetVoltage(1.25f);
+    thermo.setSensitivity(0.005f);
+
+    /** 0.01 °C units: steps of 150 °C and -327 °C between points */
+    static const int16_t deltas[5] = {0, 15000, -17700, 32000, 0};
+    static const int16_t breakpoints[5] = {-2000, 0, 500, 1500, 4000};
+
+    thermo.setCorrectionCurve(deltas, 5, -200.0f, 100.0f);
+    CHECK(worstDifference(thermo) <= thermo.getMilliCelsiusErrorBound());
+
+    thermo.setCorrectionCurve(deltas, breakpoints, 5);
+    CHECK(worstDifference(thermo) <= thermo.getMilliCelsiusErrorBound());
+
+    static uint32_t reciprocals[4];
+    thermo.setCorrectionCurve(deltas, breakpoints, 5, reciprocals);
+    CHECK(reciprocals[0] == 0xFFFFFFFFUL / 200000);
+    CHECK(worstDifference(thermo) <= thermo.getMilliCelsiusErrorBound());
+
+    /** 300 points every 0.7 °C from -60 °C: sawtooth of ±5 °C */
+    static int16_t fine[300];
+    for (int i = 0; i < 300; i++) fine[i] = (int16_t)((i % 7) * 150 - 450);
+    thermo.setCorrectionCurve(fine, 300, -60.0f, 0.7f);
+    CHECK(worstDifference(thermo) <= thermo.getMilliCelsiusErrorBound());
+
+    /** Exact at a breakpoint: 50.0 °C gets -177.00 °C */
+    float raw50 = (0.05f * 50.0f + 1.25f) * 4095.0f / 3.3f;
+    int32_t mc = thermo.rawToMilliCelsius((int)(raw50 + 0.5f));
+    CHECK_NEAR(mc, thermo.rawToCelsius((int)(raw50 + 0.5f)) * 1000.0f, 50);
+
+    thermo.clearCorrectionCurve();
+    CHECK(worstDifference(thermo) <= thermo.getMilliCelsiusErrorBound());
+
+    return TEST_RESULT();
+}
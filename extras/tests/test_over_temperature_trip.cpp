@@ -0,0 +1,90 @@
+/**
+ * AD849x_7Semi over-temperature trip
+ * - Ring-buffer mode: a single spike over the limit does not latch; the
+ *   setTripDebounce() count of consecutive samples does, and callback runs once.
+ * - Decimator mode: raw spikes are ignored, the CIC output trips with the
+ *   same threshold as readRaw() (getTripRaw()).
+ */
+
+#include "ad849x_test.h"
+
+static int trip_calls = 0;
+
+static void onTrip(void *context)
+{
+    (void)context;
+    trip_calls++;
+}
+
+int main()
+{
+    static uint16_t samples[16];
+    AD849x_7Semi thermo;
+
+    thermo.begin(0, 5.0f, 1023);
+    thermo.setOffsetVoltage(1.25f);
+    thermo.setSensitivity(0.005f);
+    thermo.setBuffer(samples, 16);
+    thermo.setBufferedMode(true);
+    thermo.setOverTemperatureTrip(95.0f, onTrip);
+
+    uint16_t limit = thermo.getTripRaw();
+    CHECK(limit > 0 && limit < 1023);
+
+    /** One spike, then back below: no trip (default 3 consecutive) */
+    thermo.pushSample(300);
+    thermo.pushSample(1023);
+    thermo.pushSample(300);
+    thermo.pushSample(limit);
+    thermo.pushSample(limit);
+    thermo.pushSample(limit - 1);
+    CHECK(!thermo.isTripped());
+
+    /** Three in a row: trips once */
+    thermo.pushSample(limit);
+    thermo.pushSample(limit + 5);
+    CHECK(!thermo.isTripped());
+    thermo.pushSample(limit);
+    CHECK(thermo.isTripped());
+    thermo.pushSample(limit);
+    CHECK(trip_calls == 1);
+
+    /** Debounce 1: single-sample trip */
+    thermo.resetTrip();
+    thermo.setTripDebounce(1);
+    thermo.pushSample(limit);
+    CHECK(thermo.isTripped());
+    CHECK(trip_calls == 2);
+
+    /** Decimator: spikes averaged away, mean at the limit trips */
+    AD849xCIC_7Semi cic;
+    CHECK(cic.configure(2, 10));
+    CHECK(thermo.setDecimator(&cic));
+    thermo.setTripDebounce(3);
+    thermo.resetTrip();
+
+    for (uint16_t i = 0; i < 200; i++) thermo.pushSample(i % 10 ? 200 : 1023);
+    CHECK(!thermo.isTripped());
+
+    for (uint16_t i = 0; i < 30; i++) thermo.pushSample(limit - 1);
+    CHECK(!thermo.isTripped());
+    CHECK(thermo.readRaw() == limit - 1);
+
+    for (uint16_t i = 0; i < 30; i++) thermo.pushSample(limit);
+    CHECK(thermo.isTripped());
+    CHECK(thermo.readRaw() == limit);
+    CHECK(trip_calls == 3);
+
+    /** With extra bits the decimated threshold follows trip_raw */
+    thermo.setOversampling(2);
+    thermo.resetTrip();
+    uint16_t limit2 = thermo.getTripRaw();
+    uint16_t edge = (limit2 + 3) >> 2;           // first native count >= limit2 / 4
+    for (uint16_t i = 0; i < 30; i++) thermo.pushSample(edge - 1);
+    CHECK(!thermo.isTripped());
+    for (uint16_t i = 0; i < 30; i++) thermo.pushSample(edge);
+    CHECK(thermo.isTripped());
+    CHECK(thermo.readRaw() >= limit2);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,24 @@
+/**
+ * AD849xStatic_7Semi::calibrate()
+ * - Host analogRead() returns 0, so the uncalibrated reading is constant
+ *   (-250 °C for 1.25 V offset, 5 mV/°C); calibrating twice must stay put.
+ */
+
+#include "ad849x_test.h"
+
+int main()
+{
+    AD849xStatic_7Semi<0, 5000, 1023, 1250, 5000> thermo;
+    thermo.begin();
+
+    CHECK_NEAR(thermo.readCelsius(), -250.0f, 0.001f);
+
+    thermo.calibrate(25.0f);
+    CHECK_NEAR(thermo.readCelsius(), 25.0f, 0.001f);
+
+    thermo.calibrate(25.0f);
+    CHECK_NEAR(thermo.readCelsius(), 25.0f, 0.001f);
+    CHECK_NEAR(thermo.readMilliCelsius(), 25000, 1);
+
+    return TEST_RESULT();
+}
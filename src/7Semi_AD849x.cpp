@@ -26,6 +26,240 @@
 
 #include "7Semi_AD849x.h"
 
+/* ---------- ADC Hook ---------- */
+/**
+ * - Weak default: a sketch-defined ad849xReadADC() replaces it at link time.
+ */
+__attribute__((weak)) uint16_t ad849xReadADC(uint8_t pin)
+{
+    return analogRead(pin);
+}
+
+/* ---------- Batch Conversion Kernels ---------- */
+/**
+ * - affineBlock() converts n counts with dst = a * x + b.
+ * - x86: AVX2 (8 lanes) or SSE2 (8 counts as two 4-lane halves).
+ * - ARM with NEON (A-profile / host servers): 8 counts as two 4-lane halves.
+ * - Everything else (AVR, Cortex-M4/M7, ESP32): scalar loop unrolled by 4.
+ *   The M4/M7 DSP extension only has integer SIMD; single-precision floats
+ *   go through the scalar FPU either way.
+ * - Every path computes exactly affine() per element, so results bit-match
+ *   the scalar rawToCelsius(): fused when the target has FMA, otherwise a
+ *   rounded multiply followed by a rounded add.
+ */
+#if defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+#define AD849X_HAS_FMA 1
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define AD849X_SIMD_X86 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define AD849X_SIMD_NEON 1
+#endif
+
+static inline float affine(float a, float x, float b)
+{
+#ifdef AD849X_HAS_FMA
+    return fmaf(a, x, b);
+#else
+    float p = a * x;
+    return p + b;
+#endif
+}
+
+static void affineBlock(const uint16_t *src, float *dst, size_t n, float a, float b)
+{
+    size_t i = 0;
+
+#if defined(AD849X_SIMD_X86) && defined(__AVX2__)
+    const __m256 va = _mm256_set1_ps(a);
+    const __m256 vb = _mm256_set1_ps(b);
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i u16 = _mm_loadu_si128((const __m128i *)(src + i));
+        __m256 x = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(u16));
+#ifdef AD849X_HAS_FMA
+        _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(va, x, vb));
+#else
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(va, x), vb));
+#endif
+    }
+#elif defined(AD849X_SIMD_X86)
+    const __m128 va = _mm_set1_ps(a);
+    const __m128 vb = _mm_set1_ps(b);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i u16 = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128 lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(u16, zero));
+        __m128 hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(u16, zero));
+#ifdef AD849X_HAS_FMA
+        _mm_storeu_ps(dst + i, _mm_fmadd_ps(va, lo, vb));
+        _mm_storeu_ps(dst + i + 4, _mm_fmadd_ps(va, hi, vb));
+#else
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(va, lo), vb));
+        _mm_storeu_ps(dst + i + 4, _mm_add_ps(_mm_mul_ps(va, hi), vb));
+#endif
+    }
+#elif defined(AD849X_SIMD_NEON)
+    const float32x4_t va = vdupq_n_f32(a);
+    const float32x4_t vb = vdupq_n_f32(b);
+
+    for (; i + 8 <= n; i += 8)
+    {
+        uint16x8_t u16 = vld1q_u16(src + i);
+        float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(u16)));
+        float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(u16)));
+#ifdef AD849X_HAS_FMA
+        vst1q_f32(dst + i, vfmaq_f32(vb, va, lo));
+        vst1q_f32(dst + i + 4, vfmaq_f32(vb, va, hi));
+#else
+        vst1q_f32(dst + i, vaddq_f32(vmulq_f32(va, lo), vb));
+        vst1q_f32(dst + i + 4, vaddq_f32(vmulq_f32(va, hi), vb));
+#endif
+    }
+#else
+    for (; i + 4 <= n; i += 4)
+    {
+        dst[i] = affine(a, src[i], b);
+        dst[i + 1] = affine(a, src[i + 1], b);
+        dst[i + 2] = affine(a, src[i + 2], b);
+        dst[i + 3] = affine(a, src[i + 3], b);
+    }
+#endif
+
+    for (; i < n; i++)
+    {
+        dst[i] = affine(a, src[i], b);
+    }
+}
+
+/* ---------- NIST ITS-90 Inverse Polynomials ---------- */
+/**
+ * - T(°C) = d0 + d1*E + d2*E^2 + ... with E in mV (NIST ITS-90 inverse functions).
+ * - Float segments hold the published coefficients.
+ * - Fixed segments hold the same polynomial rescaled for integer Horner:
+ *   - input u = E / 2^shift µV (Q30, |u| <= 1)
+ *   - q[i] = d[i] * (2^shift / 1000)^i * 1024  (°C in Q10)
+ *   - evaluated error vs the double-precision polynomial < 4 m°C over each range
+ * - Stored in flash (PROGMEM) on AVR.
+ */
+struct AD849x_FloatSegment
+{
+    float emf_min;      // Segment lower limit in mV
+    float emf_max;      // Segment upper limit in mV
+    uint8_t order;      // Number of coefficients
+    float d[10];
+};
+
+struct AD849x_FixedSegment
+{
+    int32_t emf_min;    // Segment lower limit in µV
+    int32_t emf_max;    // Segment upper limit in µV
+    uint8_t order;      // Number of coefficients
+    uint8_t shift;      // Input scale: u = E_uV / 2^shift
+    int32_t q[10];
+};
+
+static const AD849x_FloatSegment TC_K_FLOAT[] PROGMEM = {
+    {-5.891,  0.000, 9, {0.0, 2.5173462E+01, -1.1662878E+00, -1.0833638E+00, -8.9773540E-01, -3.7342377E-01, -8.6632643E-02, -1.0450598E-02, -5.1920577E-04}},
+    { 0.000, 20.644, 10, {0.0, 2.508355E+01, 7.860106E-02, -2.503131E-01, 8.315270E-02, -1.228034E-02, 9.804036E-04, -4.413030E-05, 1.057734E-06, -1.052755E-08}},
+    {20.644, 54.886, 7, {-1.318058E+02, 4.830222E+01, -1.646031E+00, 5.464731E-02, -9.650715E-04, 8.802193E-06, -3.110810E-08}}
+};
+
+static const AD849x_FloatSegment TC_J_FLOAT[] PROGMEM = {
+    {-8.095,  0.000, 9, {0.0, 1.9528268E+01, -1.2286185E+00, -1.0752178E+00, -5.9086933E-01, -1.7256713E-01, -2.8131513E-02, -2.3963370E-03, -8.3823321E-05}},
+    { 0.000, 42.919, 8, {0.0, 1.978425E+01, -2.001204E-01, 1.036969E-02, -2.549687E-04, 3.585153E-06, -5.344285E-08, 5.099890E-10}},
+    {42.919, 69.553, 6, {-3.11358187E+03, 3.00543684E+02, -9.94773230E+00, 1.70276630E-01, -1.43033468E-03, 4.73886084E-06}}
+};
+
+static const AD849x_FloatSegment TC_T_FLOAT[] PROGMEM = {
+    {-5.603,  0.000, 8, {0.0, 2.5949192E+01, -2.1316967E-01, 7.9018692E-01, 4.2527777E-01, 1.3304473E-01, 2.0241446E-02, 1.2668171E-03}},
+    { 0.000, 20.872, 7, {0.0, 2.592800E+01, -7.602961E-01, 4.637791E-02, -2.165394E-03, 6.048144E-05, -7.293422E-07}}
+};
+
+static const AD849x_FloatSegment TC_E_FLOAT[] PROGMEM = {
+    {-8.825,  0.000, 9, {0.0, 1.6977288E+01, -4.3514970E-01, -1.5859697E-01, -9.2502871E-02, -2.6084314E-02, -4.1360199E-03, -3.4034030E-04, -1.1564890E-05}},
+    { 0.000, 76.373, 10, {0.0, 1.7057035E+01, -2.3301759E-01, 6.5435585E-03, -7.3562749E-05, -1.7896001E-06, 8.4036165E-08, -1.3735879E-09, 1.0629823E-11, -3.2447087E-14}}
+};
+
+static const AD849x_FloatSegment TC_N_FLOAT[] PROGMEM = {
+    {-3.990,  0.000, 10, {0.0, 3.8436847E+01, 1.1010485E+00, 5.2229312E+00, 7.2060525E+00, 5.8488586E+00, 2.7754916E+00, 7.7075166E-01, 1.1582665E-01, 7.3138868E-03}},
+    { 0.000, 20.613, 8, {0.0, 3.86896E+01, -1.08267E+00, 4.70205E-02, -2.12169E-06, -1.17272E-04, 5.39280E-06, -7.98156E-08}},
+    {20.613, 47.513, 6, {1.972485E+01, 3.300943E+01, -3.915159E-01, 9.855391E-03, -1.274371E-04, 7.767022E-07}}
+};
+
+static const AD849x_FixedSegment TC_K_FIXED[] PROGMEM = {
+    {-5891, 0, 9, 13, {0, 211170L, -80147L, -609880L, -4140074L, -14107551L, -26811504L, -26495414L, -10783482L}},
+    {0, 20644, 10, 15, {0, 841664L, 86423L, -9018480L, 98169381L, -475072643L, 1242809212L, -1833100944L, 1439712916L, -469544420L}},
+    {20644, 54886, 7, 16, {-134969L, 3241507L, -7239321L, 15751015L, -18229685L, 10896587L, -2523789L}}
+};
+
+static const AD849x_FixedSegment TC_J_FIXED[] PROGMEM = {
+    {-8095, 0, 9, 13, {0, 163815L, -84430L, -605294L, -2724904L, -6519402L, -8706282L, -6075436L, -1740942L}},
+    {0, 42919, 8, 16, {0, 1327699L, -880139L, 2988860L, -4816223L, 4438204L, -4335799L, 2711567L}},
+    {42919, 69553, 6, 17, {-3188308L, 40338290L, -175002357L, 392631177L, -432292131L, 187725618L}}
+};
+
+static const AD849x_FixedSegment TC_T_FIXED[] PROGMEM = {
+    {-5603, 0, 8, 13, {0, 217678L, -14649, 444836L, 1961248L, 5026288L, 6264424L, 3211763L}},
+    {0, 20872, 7, 15, {0, 869999L, -835954L, 1670940L, -2556446L, 2339762L, -924551L}}
+};
+
+static const AD849x_FixedSegment TC_E_FIXED[] PROGMEM = {
+    {-8825, 0, 9, 14, {0, 284832L, -119613L, -714257L, -6825507L, -31534001L, -81922314L, -110446742L, -61489502L}},
+    {0, 76373, 10, 17, {0, 2289356L, -4099289L, 15088419L, -22232977L, -70893364L, 436340716L, -934815484L, 948211897L, -379371766L}}
+};
+
+static const AD849x_FixedSegment TC_N_FIXED[] PROGMEM = {
+    {-3990, 0, 10, 12, {0, 161216L, 18916, 367531L, 2077003L, 6905113L, 13421454L, 15266309L, 9396974L, 2430456L}},
+    {0, 20613, 8, 15, {0, 1298208L, -1190408L, 1694092L, -2505, -4536741L, 6836186L, -3315410L}},
+    {20613, 47513, 6, 16, {20198, 2215225L, -1721905L, 2840623L, -2407219L, 961511L}}
+};
+
+/* ---------- Device Profiles ---------- */
+/**
+ * - Indexed by AD849x_Device. Values per datasheet (verify for your module).
+ * - AD8494/AD8496: J-type, gain 96.7; AD8495/AD8497: K-type, gain 122.4.
+ * - All variants: 5mV/°C output, 1.25V REF offset on typical breakout boards.
+ */
+static const AD849x_DeviceProfile DEVICE_PROFILES[AD849X_DEVICE_COUNT] PROGMEM = {
+    {1.25, 0.005, 96.7, AD849X_TYPE_J},     // AD8494
+    {1.25, 0.005, 122.4, AD849X_TYPE_K},    // AD8495
+    {1.25, 0.005, 96.7, AD849X_TYPE_J},     // AD8496
+    {1.25, 0.005, 122.4, AD849X_TYPE_K},    // AD8497
+};
+
+static const AD849x_FloatSegment *floatSegments(AD849x_ThermocoupleType type, uint8_t &count)
+{
+    switch (type)
+    {
+    case AD849X_TYPE_K: count = 3; return TC_K_FLOAT;
+    case AD849X_TYPE_J: count = 3; return TC_J_FLOAT;
+    case AD849X_TYPE_T: count = 2; return TC_T_FLOAT;
+    case AD849X_TYPE_E: count = 2; return TC_E_FLOAT;
+    case AD849X_TYPE_N: count = 3; return TC_N_FLOAT;
+    default: count = 0; return nullptr;
+    }
+}
+
+static const AD849x_FixedSegment *fixedSegments(AD849x_ThermocoupleType type, uint8_t &count)
+{
+    switch (type)
+    {
+    case AD849X_TYPE_K: count = 3; return TC_K_FIXED;
+    case AD849X_TYPE_J: count = 3; return TC_J_FIXED;
+    case AD849X_TYPE_T: count = 2; return TC_T_FIXED;
+    case AD849X_TYPE_E: count = 2; return TC_E_FIXED;
+    case AD849X_TYPE_N: count = 3; return TC_N_FIXED;
+    default: count = 0; return nullptr;
+    }
+}
+
 /* ---------- Constructor ---------- */
 AD849x_7Semi::AD849x_7Semi()
 {
@@ -58,11 +292,18 @@ void AD849x_7Semi::begin(uint8_t analogPin,
     reference_voltage = vRef;
     resolution = adcResolution;
 
-    offset = 0.0;
-    gain = 1.0;
+    offset = 0.0f;
+    gain = 1.0f;
 
     filtered_temperature = NAN;
     avg_sample = 10;
+    os_request = 0;
+    applyOversampling();
+
+    acq_busy = false;
+    acq_ready = false;
+
+    cache_valid = false;
 
     pinMode(analog_pin, INPUT);
 }
@@ -75,6 +316,7 @@ void AD849x_7Semi::setVref(float vRef)
      * - Example: 3.3V or 5.0V depending on your MCU analog reference.
      */
     reference_voltage = vRef;
+    updateCoefficients();
 }
 
 void AD849x_7Semi::setADCResolution(uint16_t adcResolution)
@@ -86,6 +328,7 @@ void AD849x_7Semi::setADCResolution(uint16_t adcResolution)
      *   - 12-bit ADC: 4095
      */
     resolution = adcResolution;
+    applyOversampling();
 }
 
 void AD849x_7Semi::setOffsetVoltage(float offset)
@@ -97,6 +340,7 @@ void AD849x_7Semi::setOffsetVoltage(float offset)
      *   tempC = (voltage - offset_voltage) / sensitivity
      */
     offset_voltage = offset;
+    updateCoefficients();
 }
 
 void AD849x_7Semi::setSensitivity(float voltsPerDegC)
@@ -107,23 +351,23 @@ void AD849x_7Semi::setSensitivity(float voltsPerDegC)
      *   - 0.005 V/°C (5mV/°C)
      */
     sensitivity = voltsPerDegC;
+    updateCoefficients();
 }
 
-void AD849x_7Semi::setSampling(uint8_t samples)
+void AD849x_7Semi::setSampling(uint16_t samples)
 {
     /**
      * - Sets number of ADC samples to average.
      * - Useful to reduce noise on the analog reading.
      * - Limits:
      *   - Minimum: 1
-     *   - Maximum: 200 (to avoid long blocking reads)
+     *   - Maximum: 65535 (uint32_t sum: 65535 * 65535 still fits)
      */
     if (samples == 0) samples = 1;
-    if (samples > 200) samples = 200;
     avg_sample = samples;
 }
 
-uint8_t AD849x_7Semi::getSampling()
+uint16_t AD849x_7Semi::getSampling()
 {
     /**
      * - Returns the current averaging sample count.
@@ -131,6 +375,96 @@ uint8_t AD849x_7Semi::getSampling()
     return avg_sample;
 }
 
+void AD849x_7Semi::setSamplingBudgetUs(uint32_t us)
+{
+    /**
+     * - 0 = fixed sample count, otherwise sample until the budget is used up.
+     */
+    sample_budget_us = us;
+}
+
+uint32_t AD849x_7Semi::getSamplingBudgetUs()
+{
+    return sample_budget_us;
+}
+
+uint16_t AD849x_7Semi::getLastSampleCount()
+{
+    return last_count;
+}
+
+float AD849x_7Semi::getSampleVariance()
+{
+    return last_variance;
+}
+
+float AD849x_7Semi::getMeasurementVarianceC()
+{
+    /**
+     * - Variance of the averaged reading in counts^2:
+     *   (sample variance + 1/12 quantization) / samples
+     * - Scaled by the local slope (°C per native count) of the full
+     *   conversion pipeline, so linearization and curves are included.
+     */
+    uint16_t n = last_count ? last_count : 1;
+    float varCounts = (last_variance + (1.0f / 12.0f)) / n;
+    float slope = rawToCelsius(last_raw + (1 << os_bits)) - rawToCelsius(last_raw);
+
+    return varCounts * slope * slope;
+}
+
+void AD849x_7Semi::setOversampling(uint8_t extraBits)
+{
+    /**
+     * - Oversample 4^n, decimate by 2^n -> n extra bits.
+     * - Clamped in applyOversampling() against the current ADC resolution
+     *   and, in buffered mode, the ring buffer capacity.
+     */
+    os_request = extraBits;
+    applyOversampling();
+}
+
+uint8_t AD849x_7Semi::getOversampling()
+{
+    return os_bits;
+}
+
+uint16_t AD849x_7Semi::getEffectiveResolution()
+{
+    return effective_resolution;
+}
+
+void AD849x_7Semi::applyOversampling()
+{
+    /**
+     * - Limits extra bits to 6 and to an effective max count <= 32767.
+     * - Buffered mode: 4^os_bits must fit the ring (ring_mask = size - 1
+     *   samples), otherwise every reading would average fewer samples than
+     *   the extra bits claim. A decimator supplies its own precision.
+     * - Recomputes the effective resolution used by rawToVoltage().
+     * - Cached readings use the old scale, so the cache is dropped.
+     */
+    os_bits = (os_request > 6) ? 6 : os_request;
+
+    while (os_bits && ((uint32_t)resolution << os_bits) > 32767)
+    {
+        os_bits--;
+    }
+
+    if (buffered && !decimator)
+    {
+        while (os_bits && ((uint16_t)1 << (2 * os_bits)) > ring_mask)
+        {
+            os_bits--;
+        }
+    }
+
+    effective_resolution = resolution << os_bits;
+    cache_valid = false;
+
+    updateCoefficients();
+}
+
 /* ---------- Reading ---------- */
 int AD849x_7Semi::readRaw()
 {
@@ -138,15 +472,270 @@ int AD849x_7Semi::readRaw()
      * - Reads ADC multiple times and returns the averaged raw ADC count.
      * - Output range depends on your ADC resolution:
      *   - 0 to resolution (e.g., 0..4095)
+     *   - 0 to getEffectiveResolution() when oversampling is enabled
+     * - When the cache is enabled, a value younger than maxAgeMs is reused.
+     */
+    refresh();
+    return last_raw;
+}
+
+float AD849x_7Semi::readRawMean()
+{
+    /**
+     * - Float average of the same acquisition used by readRaw().
+     */
+    refresh();
+    return last_mean;
+}
+
+void AD849x_7Semi::refresh()
+{
+    /**
+     * - Updates last_raw / last_mean unless the cached value is still fresh.
+     */
+    if (cache_max_age == 0)
+    {
+        acquire();
+        return;
+    }
+
+    uint32_t now = millis();
+
+    if (cache_valid && (now - cache_time) < cache_max_age)
+    {
+        cache_hits++;
+        return;
+    }
+
+    cache_misses++;
+    acquire();
+    cache_time = now;
+    cache_valid = true;
+}
+
+void AD849x_7Semi::acquire()
+{
+    /**
+     * - Performs the actual acquisition (no cache).
+     * - In buffered mode the samples come from the ISR ring buffer;
+     *   if nothing new was buffered the previous result is kept.
+     * - With a decimator the ISR has already reduced the samples; the latched
+     *   comb output is copied and its gain removed here, outside the ISR
+     *   (previous result kept until a new one).
+     * - Before the first CIC output (start-up: (order + 1) * ratio samples)
+     *   the latest single ISR sample is used instead, so readings are never
+     *   a placeholder 0. If no sample has arrived at all, waits up to 100 ms
+     *   for the first one.
+     */
+    uint32_t sum = 0;
+    uint64_t sumSq = 0;
+    uint16_t ref = 0;
+    uint16_t count;
+
+    if (decimator)
+    {
+        const uint32_t FIRST_SAMPLE_TIMEOUT_US = 100000;
+        uint32_t start = micros();
+        bool fresh;
+        bool ready;
+        uint32_t out;
+        uint16_t latest;
+
+        do
+        {
+            noInterrupts();
+            fresh = decimated_fresh;
+            ready = decimated_ready;
+            out = decimated_out;
+            latest = decimated_latest;
+            decimated_fresh = false;
+            interrupts();
+        } while (!fresh && latest == DECIMATOR_NO_SAMPLE &&
+                 (micros() - start) < FIRST_SAMPLE_TIMEOUT_US);
+
+        uint16_t value;
+
+        if (fresh)
+        {
+            uint32_t ratio = decimator->getRatio();
+            value = (uint16_t)decimator->normalize(out, os_bits);
+            last_count = (ratio > 0xFFFF) ? 0xFFFF : (uint16_t)ratio;
+        }
+        else if (!ready && latest != DECIMATOR_NO_SAMPLE)
+        {
+            value = latest << os_bits;
+            last_count = 1;
+        }
+        else
+        {
+            return;
+        }
+
+        last_raw = value;
+        last_mean = value;
+        last_variance = 0;                   // no per-sample data behind a CIC output
+        return;                              // trip checked per output in pushSample()
+    }
+
+    if (buffered)
+    {
+        count = readBufferedSum(sum, sumSq, ref);
+        if (count == 0) return;
+    }
+    else
+    {
+        uint32_t start = micros();
+        count = 0;
+        ref = sampleADC();
+
+        int32_t d = 0;
+        do
+        {
+            uint32_t ad = (d < 0) ? -d : d;      // |d| < 2^16: square fits 32 bits
+            sum += ref + d;
+            sumSq += ad * ad;
+            count++;
+            if (windowDone(count, start)) break;
+            d = (int32_t)sampleADC() - ref;
+        } while (true);
+    }
+
+    last_count = count;
+    last_raw = averageToRaw(sum, count);
+    last_mean = ((float)sum * (1U << os_bits)) / count;
+
+    if (count > 1)
+    {
+        /**
+         * - Sample variance from deviations against the first sample
+         *   (shifted data: no cancellation of large sums).
+         */
+        int32_t sumD = (int32_t)(sum - (uint32_t)ref * count);
+        float meanD = (float)sumD / count;
+        last_variance = ((float)sumSq - meanD * sumD) / (count - 1);
+        if (last_variance < 0) last_variance = 0;
+    }
+    else
+    {
+        last_variance = 0;                   // a single sample has no spread
+    }
+
+    if (trip_armed && last_raw >= trip_raw && !tripped) trip();
+}
+
+uint16_t AD849x_7Semi::windowLength()
+{
+    /**
+     * - Samples per reading: 4^os_bits when oversampling, otherwise avg_sample.
+     */
+    if (os_bits) return (uint16_t)1 << (2 * os_bits);
+    return avg_sample;
+}
+
+bool AD849x_7Semi::windowDone(uint16_t count, uint32_t startUs)
+{
+    /**
+     * - Fixed window: count reached windowLength().
+     * - Time budget: budget elapsed, or 65535 samples (uint16_t count limit).
+     */
+    if (sample_budget_us == 0) return count >= windowLength();
+    if (count == 0xFFFF) return true;
+    return (micros() - startUs) >= sample_budget_us;
+}
+
+int AD849x_7Semi::averageToRaw(uint32_t sum, uint16_t count)
+{
+    /**
+     * - Integer average in effective counts:
+     *   raw = (sum << os_bits) / count
+     * - For a full oversampling window (count = 4^n) this is exactly sum >> n.
+     * - No overflow: count <= 65535 and (resolution << n) <= 32767,
+     *   so (sum << n) <= 65535 * 32767 < 2^32.
+     */
+    return (sum << os_bits) / count;
+}
+
+/* ---------- Block Acquisition ---------- */
+size_t AD849x_7Semi::readRawBlock(uint16_t *dst, size_t n)
+{
+    /**
+     * - Burst capture for transients; no averaging, no cache.
+     */
+    if (!dst) return 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        dst[i] = sampleADC();
+    }
+
+    return n;
+}
+
+void AD849x_7Semi::convertBlock(const uint16_t *src, float *dstC, size_t n)
+{
+    /**
+     * - tempC = a_native * raw + b
+     * - readRawBlock() samples are native counts; a is scaled by 2^os_bits
+     *   (exact in float) to match.
      */
-    uint32_t value = 0;
+    if (!src || !dstC) return;
+
+    if ((lut_ram || lut_flash) && os_bits == 0)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            uint16_t code = src[i];
+            dstC[i] = (code < lut_entries) ? lutRead(code) : computeCelsius(code);
+        }
+        return;
+    }
 
-    for (uint8_t i = 0; i < avg_sample; i++)
+    if (tc_type != AD849X_TYPE_LINEAR || curve_points)
     {
-        value += analogRead(analog_pin);
+        for (size_t i = 0; i < n; i++)
+        {
+            dstC[i] = computeCelsius((int32_t)src[i] << os_bits);
+        }
+        return;
     }
 
-    return value / avg_sample;
+    affineBlock(src, dstC, n, coef_a * (float)(1U << os_bits), coef_b);
+}
+
+/* ---------- Reading Cache ---------- */
+void AD849x_7Semi::setCacheMaxAge(uint32_t maxAgeMs)
+{
+    /**
+     * - 0 disables caching; any change drops the current cached value.
+     */
+    cache_max_age = maxAgeMs;
+    cache_valid = false;
+}
+
+uint32_t AD849x_7Semi::getCacheMaxAge()
+{
+    return cache_max_age;
+}
+
+void AD849x_7Semi::invalidateCache()
+{
+    cache_valid = false;
+}
+
+uint32_t AD849x_7Semi::getCacheHits()
+{
+    return cache_hits;
+}
+
+uint32_t AD849x_7Semi::getCacheMisses()
+{
+    return cache_misses;
+}
+
+void AD849x_7Semi::resetCacheStats()
+{
+    cache_hits = 0;
+    cache_misses = 0;
 }
 
 float AD849x_7Semi::rawToVoltage(int raw)
@@ -157,109 +746,1270 @@ float AD849x_7Semi::rawToVoltage(int raw)
      *
      * Note:
      * - resolution must be the ADC max count (1023, 4095, etc.)
+     * - With oversampling, the effective max count (resolution << n) is used.
      */
-    return (raw * reference_voltage) / resolution;
+    return (raw * reference_voltage) / effective_resolution;
 }
 
-float AD849x_7Semi::readVoltage()
+float AD849x_7Semi::rawToVoltage(float rawMean)
 {
     /**
-     * - Reads averaged ADC count and converts it to volts.
+     * - Same as rawToVoltage(int) for fractional counts from readRawMean().
      */
-    return rawToVoltage(readRaw());
+    return (rawMean * reference_voltage) / effective_resolution;
 }
 
-/* ---------- Temperature ---------- */
-float AD849x_7Semi::voltageToCelsius(float voltage)
+/* ---------- Non-blocking Acquisition ---------- */
+void AD849x_7Semi::startConversion(bool continuous)
 {
     /**
-     * - Converts amplifier output voltage to °C.
-     * - Base formula:
-     *   tempC = (voltage - offset_voltage) / sensitivity
-     *
-     * - Then applies user calibration:
-     *   tempC = (tempC * gain) + offset
-     *
-     * Where:
-     * - offset is updated by calibrate() (single point calibration)
-     * - gain can be used for scaling (if you add a gain calibration in future)
+     * - Arms a new averaging window (avg_sample samples, or 4^n when oversampling).
+     * - The window length is checked on every poll(), so setSampling() and
+     *   setOversampling() may be called at any time.
      */
-    float temp = (voltage - offset_voltage) / sensitivity;
-    temp = (temp * gain) + offset;
-    return temp;
+    acq_sum = 0;
+    acq_count = 0;
+    acq_start_us = micros();
+    acq_continuous = continuous;
+    acq_busy = true;
 }
 
-float AD849x_7Semi::readCelsius()
+bool AD849x_7Semi::poll()
 {
     /**
-     * - Reads voltage from ADC and converts it to °C.
+     * - One ADC sample per call, then returns immediately.
+     * - When the window is complete:
+     *   - publishes the average (same integer math and scale as readRaw())
+     *   - sets the available() flag
+     *   - restarts the window in continuous mode, otherwise goes idle
      */
-    return voltageToCelsius(readVoltage());
+    if (!acq_busy) return false;
+
+    acq_sum += sampleADC();
+    acq_count++;
+
+    if (!windowDone(acq_count, acq_start_us)) return false;
+
+    acq_result = averageToRaw(acq_sum, acq_count);
+    acq_ready = true;
+
+    acq_sum = 0;
+    acq_count = 0;
+    acq_start_us = micros();
+    acq_busy = acq_continuous;
+
+    return true;
 }
 
-float AD849x_7Semi::readFahrenheit()
+bool AD849x_7Semi::available()
 {
     /**
-     * - Returns temperature in °F using:
-     *   °F = (°C * 9/5) + 32
+     * - True when a result is waiting to be read by getConversion().
      */
-    return (readCelsius() * 9.0 / 5.0) + 32.0;
+    return acq_ready;
 }
 
-float AD849x_7Semi::readKelvin()
+int AD849x_7Semi::getConversion()
 {
     /**
-     * - Returns temperature in Kelvin using:
-     *   K = °C + 273.15
+     * - Returns the last completed average and marks it as consumed.
      */
-    return readCelsius() + 273.15;
+    acq_ready = false;
+    return acq_result;
 }
 
-/* ---------- Calibration ---------- */
-void AD849x_7Semi::calibrate(float actualTempC)
+bool AD849x_7Semi::isConverting()
 {
     /**
-     * - Simple 1-point calibration.
-     * - Measures current temperature and adjusts internal offset so that:
-     *   measured + offset == actualTempC
-     *
-     * Usage example:
-     * - Put thermocouple in a known stable temperature point
-     *   (e.g., ice bath ~0°C, boiling water ~100°C at sea level),
-     *   then call calibrate(knownTempC).
+     * - True while samples are still being collected.
      */
-    float measured = readCelsius();
-    offset = actualTempC - measured;
+    return acq_busy;
 }
 
-/* ---------- Filtering ---------- */
-float AD849x_7Semi::readFilteredTemperatureC(float alpha)
+/* ---------- Buffered (ISR) Acquisition ---------- */
+bool AD849x_7Semi::setBuffer(uint16_t *buf, uint8_t size)
 {
     /**
-     * - Exponential moving average (IIR low-pass filter).
-     * - alpha range:
-     *   - 1.0 : no filtering (output follows current reading)
-     *   - 0.0 : output never changes (not useful)
-     *   - Typical: 0.05 to 0.3 depending on noise and response needed
-     *
-     * Formula:
-     *   filtered = alpha * current + (1 - alpha) * previous_filtered
-     *
-     * Notes:
-     * - On first call, it initializes filter output to the current reading.
+     * - Swapped with interrupts off: the ISR sees either the old or new buffer.
      */
-    float current = readCelsius();
+    if (buf && (size < 2 || (size & (size - 1)) != 0 || size > 128)) return false;
 
-    if (isnan(filtered_temperature))
-    {
-        filtered_temperature = current;
-    }
+    noInterrupts();
+    ring = buf;
+    ring_mask = buf ? size - 1 : 0;
+    ring_head = 0;
+    ring_tail = 0;
+    interrupts();
 
-    filtered_temperature = alpha * current + (1.0 - alpha) * filtered_temperature;
-    return filtered_temperature;
+    applyOversampling();
+    return true;
 }
 
-/* ---------- Diagnostics ---------- */
+void AD849x_7Semi::setBufferedMode(bool enable)
+{
+    /**
+     * - Switches readRaw() between ring buffer and analogRead().
+     * - Buffer is emptied so stale samples are not mixed in.
+     */
+    noInterrupts();
+    ring_head = 0;
+    ring_tail = 0;
+    interrupts();
+
+    buffered = enable;
+    applyOversampling();
+}
+
+void AD849x_7Semi::pushSample(uint16_t sample)
+{
+    /**
+     * - Single producer (ISR), single consumer (readRaw()).
+     * - Keeps the newest size - 1 samples (setBuffer()):
+     *   - when full, the tail is advanced and the oldest sample is lost.
+     * - The consumer reads with interrupts disabled, so moving the tail here is safe.
+     * - Over-temperature trip: integer compares against precomputed counts,
+     *   on each CIC output in decimator mode, otherwise on trip_samples
+     *   consecutive raw samples.
+     */
+    if (decimator)
+    {
+        if (!decimated_ready) decimated_latest = sample;   // start-up stand-in
+
+        if (decimator->push(sample))
+        {
+            uint32_t out = decimator->rawOutput();
+            decimated_out = out;                        // gain removed in acquire()
+            decimated_fresh = true;
+            decimated_ready = true;
+            if (trip_armed && out >= trip_decimated && !tripped) trip();
+        }
+        return;
+    }
+
+    if (trip_armed && !tripped)
+    {
+        if (sample < trip_native) trip_run = 0;
+        else if (++trip_run >= trip_samples) trip();
+    }
+
+    if (!ring) return;
+
+    uint8_t head = ring_head;
+    uint8_t next = (head + 1) & ring_mask;
+
+    ring[head] = sample;
+
+    if (next == ring_tail)
+    {
+        ring_tail = (next + 1) & ring_mask;
+    }
+
+    ring_head = next;
+}
+
+bool AD849x_7Semi::setDecimator(AD849xCIC_7Semi *cic)
+{
+    /**
+     * - The CIC registers are sized for inputBits-wide samples; wider ADC
+     *   codes would overflow them.
+     * - Swapped with interrupts off: the ISR sees either the old or new stage.
+     */
+    if (cic && cic->getInputBits() < 16 && ((uint32_t)1 << cic->getInputBits()) <= resolution) return false;
+
+    noInterrupts();
+    decimator = cic;
+    decimated_fresh = false;
+    decimated_ready = false;
+    decimated_latest = DECIMATOR_NO_SAMPLE;
+    interrupts();
+
+    applyOversampling();
+    return true;
+}
+
+uint8_t AD849x_7Semi::bufferedCount()
+{
+    /**
+     * - Samples currently stored (0 .. size - 1, 0 without a buffer).
+     */
+    noInterrupts();
+    uint8_t count = (ring_head - ring_tail) & ring_mask;
+    interrupts();
+
+    return count;
+}
+
+uint8_t AD849x_7Semi::readBufferedSum(uint32_t &sum, uint64_t &sumSq, uint16_t &ref)
+{
+    /**
+     * - Sums the newest min(window, buffered) samples and returns how many were used.
+     * - sumSq: squared deviations from ref (the newest sample) for the noise estimate.
+     * - Drains the whole buffer so every result only uses fresh samples.
+     * - Samples are copied out newest first, 16 at a time with interrupts
+     *   disabled; the sums run with interrupts enabled in between.
+     * - Slots the ISR has overwritten since the snapshot (oldest first) are
+     *   not used, so a fast producer only shortens the window.
+     */
+    const uint8_t CHUNK = 16;
+    uint16_t window = windowLength();
+    uint16_t samples[CHUNK];
+    uint8_t used = 0;
+
+    noInterrupts();
+    uint8_t head = ring_head;
+    uint8_t count = (head - ring_tail) & ring_mask;
+    interrupts();
+
+    if (count > window) count = window;
+
+    while (used < count)
+    {
+        uint8_t n = 0;
+
+        noInterrupts();
+        uint8_t pushed = (ring_head - head) & ring_mask;
+        uint8_t valid = ring_mask + 1 - pushed;      // slots not yet overwritten
+        if (count > valid) count = valid;
+
+        while (n < CHUNK && used + n < count)
+        {
+            samples[n] = ring[(head - 1 - used - n) & ring_mask];
+            n++;
+        }
+        interrupts();
+
+        if (used == 0 && n > 0) ref = samples[0];
+
+        for (uint8_t i = 0; i < n; i++)
+        {
+            int32_t d = (int32_t)samples[i] - ref;
+            uint32_t ad = (d < 0) ? -d : d;
+            sum += samples[i];
+            sumSq += ad * ad;
+        }
+
+        used += n;
+        if (n == 0) break;
+    }
+
+    /** Drop everything up to the snapshot, unless the ISR already moved past it */
+    noInterrupts();
+    if (((ring_head - head) & ring_mask) <= ((ring_head - ring_tail) & ring_mask))
+    {
+        ring_tail = head;
+    }
+    interrupts();
+
+    return used;
+}
+
+#if defined(__AVR__)
+void AD849x_7Semi::startFreeRunningADC(uint8_t prescaler)
+{
+    /**
+     * - Selects analog_pin as ADC channel (AVcc reference, same as analogReference(DEFAULT)).
+     * - Auto trigger source = free running, interrupt on every conversion.
+     * - Pin -> channel mapping matches analogRead(): A0.. pin numbers are
+     *   rebased on PIN_A0, then analogPinToChannel() where the core has it.
+     */
+    uint8_t channel = analog_pin;
+#if defined(PIN_A0)
+    if (channel >= PIN_A0) channel -= PIN_A0;   // A0 is a const variable, PIN_A0 the macro
+#endif
+#if defined(analogPinToChannel)
+    channel = analogPinToChannel(channel);
+#endif
+
+#if defined(MUX5)
+    ADCSRB = (channel & 0x08) ? (1 << MUX5) : 0;
+#else
+    ADCSRB = 0;
+#endif
+
+    ADMUX = (1 << REFS0) | (channel & 0x07);
+    ADCSRA = (1 << ADEN) | (1 << ADATE) | (1 << ADIE) | (1 << ADSC) | (prescaler & 0x07);
+}
+
+void AD849x_7Semi::stopFreeRunningADC()
+{
+    /**
+     * - Disables auto trigger and interrupt; keeps the /128 prescaler used by the Arduino core.
+     */
+    ADCSRA = (1 << ADEN) | 0x07;
+}
+#endif
+
+float AD849x_7Semi::readVoltage()
+{
+    /**
+     * - Reads averaged ADC count and converts it to volts.
+     */
+    return rawToVoltage(readRaw());
+}
+
+/* ---------- Temperature ---------- */
+float AD849x_7Semi::voltageToCelsius(float voltage)
+{
+    /**
+     * - Converts amplifier output voltage to °C.
+     * - Base formula:
+     *   tempC = (voltage - offset_voltage) / sensitivity
+     *
+     * - Then applies user calibration:
+     *   tempC = (tempC * gain) + offset
+     *
+     * Where:
+     * - offset is updated by calibrate() (single point calibration)
+     * - gain can be used for scaling (if you add a gain calibration in future)
+     *
+     * - With a thermocouple type selected, the base formula is replaced by:
+     *   tempC = NIST((voltage - offset_voltage) * 1000 / amplifier_gain)
+     */
+    float temp;
+
+    if (tc_type == AD849X_TYPE_LINEAR)
+    {
+        temp = (voltage - offset_voltage) / sensitivity;
+    }
+    else
+    {
+        temp = emfToCelsius(tc_type, (voltage - offset_voltage) * 1000.0f / amplifier_gain);
+    }
+
+    temp = (temp * gain) + offset;
+
+    if (curve_points) temp += curveCorrection(temp);
+    return temp;
+}
+
+float AD849x_7Semi::rawToCelsius(int raw)
+{
+    /**
+     * - Hot path: one indexed load when a lookup table is attached,
+     *   otherwise one multiply-add with coefficients from updateCoefficients().
+     */
+    if (lutActive(raw)) return lutRead(raw);
+    return computeCelsius(raw);
+}
+
+void AD849x_7Semi::rawToCelsius(const uint16_t *src, float *dstC, size_t n)
+{
+    /**
+     * - Batch rawToCelsius(): src holds readRaw()-scale counts.
+     * - Linear without table or curve: vectorized affine kernel.
+     * - Otherwise: per-sample rawToCelsius() (table / NIST / curve).
+     */
+    if (!src || !dstC) return;
+
+    if (tc_type != AD849X_TYPE_LINEAR || curve_points || lut_ram || lut_flash)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            dstC[i] = rawToCelsius(src[i]);
+        }
+        return;
+    }
+
+    affineBlock(src, dstC, n, coef_a, coef_b);
+}
+
+float AD849x_7Semi::computeCelsius(int raw)
+{
+    /**
+     * - Full conversion pipeline, never uses the lookup table.
+     * - Linear: one multiply-add.
+     * - Linearized: raw -> EMF (multiply-add) -> NIST polynomial -> gain / offset.
+     */
+    float temp;
+
+    if (tc_type == AD849X_TYPE_LINEAR) temp = affine(coef_a, (float)raw, coef_b);
+    else temp = emfToCelsius(tc_type, emf_a * raw + emf_b) * gain + offset;
+
+    if (curve_points) temp += curveCorrection(temp);
+    return temp;
+}
+
+/* ---------- Correction Curve ---------- */
+void AD849x_7Semi::setCorrectionCurve(const int16_t *deltas, uint16_t points, float startC, float stepC)
+{
+    /**
+     * - Precomputes the reciprocal of the step so evaluation needs no division.
+     * - Integer path: the m°C step is shifted below 2^16 and its reciprocal
+     *   stored as a 16-bit mantissa m = 2^s / step (m <= 0xFFFF, s >= 16).
+     */
+    if (!deltas || points < 2 || stepC <= 0)
+    {
+        clearCorrectionCurve();
+        return;
+    }
+
+    curve_y = deltas;
+    curve_x = nullptr;
+    curve_points = points;
+    curve_x0 = startC;
+    curve_inv_step = 1.0f / stepC;
+    curve_x0_mc = lroundf(startC * 1000.0f);
+    curve_recip = nullptr;
+
+    uint32_t step = lroundf(stepC * 1000.0f);
+    if (step < 1) step = 1;
+
+    curve_step_shift = 0;
+    while ((step >> curve_step_shift) > 0xFFFFUL) curve_step_shift++;
+    curve_step_s = (uint16_t)(step >> curve_step_shift);
+
+    curve_recip_s = 16;
+    while (((uint32_t)2 << (curve_recip_s - 16)) <= curve_step_s) curve_recip_s++;
+
+    uint32_t m = (uint32_t)(ldexpf(1.0f, curve_recip_s) / curve_step_s + 0.5f);
+    curve_recip_m = (m > 0xFFFF) ? 0xFFFF : (uint16_t)m;
+    curve_span_s = (uint32_t)(points - 1) * curve_step_s;
+
+    measureCurve();
+    updateCoefficients();
+}
+
+void AD849x_7Semi::setCorrectionCurve(const int16_t *deltas, const int16_t *breakpoints, uint16_t points, uint32_t *reciprocals)
+{
+    /**
+     * - reciprocals[i] = floor(2^32 / width_i), width in m°C (>= 100):
+     *   d < width keeps d * reciprocals[i] below 2^32.
+     */
+    if (!deltas || !breakpoints || points < 2)
+    {
+        clearCorrectionCurve();
+        return;
+    }
+
+    curve_y = deltas;
+    curve_x = breakpoints;
+    curve_points = points;
+    curve_recip = reciprocals;
+
+    if (reciprocals)
+    {
+        for (uint16_t i = 0; i + 1 < points; i++)
+        {
+            uint32_t width = (uint32_t)(breakpoints[i + 1] - breakpoints[i]) * 100;
+            reciprocals[i] = width ? 0xFFFFFFFFUL / width : 0;
+        }
+    }
+
+    measureCurve();
+    updateCoefficients();
+}
+
+void AD849x_7Semi::measureCurve()
+{
+    /**
+     * - Steepest rise and narrowest segment, for getMilliCelsiusErrorBound().
+     */
+    curve_dy_max_mc = 0;
+    curve_dx_min_mc = curve_x ? 0xFFFFFFFFUL : (uint32_t)curve_step_s << curve_step_shift;
+
+    for (uint16_t i = 0; i + 1 < curve_points; i++)
+    {
+        int32_t dy = (int32_t)(curve_y[i + 1] - curve_y[i]) * 10;
+        if (dy < 0) dy = -dy;
+        if ((uint32_t)dy > curve_dy_max_mc) curve_dy_max_mc = dy;
+
+        if (curve_x)
+        {
+            uint32_t dx = (uint32_t)(curve_x[i + 1] - curve_x[i]) * 100;
+            if (dx < curve_dx_min_mc) curve_dx_min_mc = dx;
+        }
+    }
+
+    if (curve_dx_min_mc == 0) curve_dx_min_mc = 1;
+}
+
+void AD849x_7Semi::clearCorrectionCurve()
+{
+    curve_y = nullptr;
+    curve_x = nullptr;
+    curve_recip = nullptr;
+    curve_points = 0;
+
+    updateCoefficients();
+}
+
+float AD849x_7Semi::curveCorrection(float tempC)
+{
+    /**
+     * - Uniform: pos = (tempC - x0) / step via multiply, i = floor(pos), lerp.
+     * - Non-uniform: binary search on breakpoints (0.1°C), then lerp.
+     * - Result converted from 0.01°C to °C.
+     */
+    if (!curve_points) return 0;
+
+    uint16_t last = curve_points - 1;
+    uint16_t i;
+    float frac;
+
+    if (!curve_x)
+    {
+        float pos = (tempC - curve_x0) * curve_inv_step;
+        if (pos <= 0) return curve_y[0] * 0.01f;
+        if (pos >= last) return curve_y[last] * 0.01f;
+
+        i = (uint16_t)pos;
+        frac = pos - i;
+    }
+    else
+    {
+        float key = tempC * 10.0f;
+        if (key <= curve_x[0]) return curve_y[0] * 0.01f;
+        if (key >= curve_x[last]) return curve_y[last] * 0.01f;
+
+        i = curveSegment(key);
+        frac = (key - curve_x[i]) / (float)(curve_x[i + 1] - curve_x[i]);
+    }
+
+    return (curve_y[i] + (curve_y[i + 1] - curve_y[i]) * frac) * 0.01f;
+}
+
+int32_t AD849x_7Semi::curveCorrectionMilli(int32_t tempMilliC)
+{
+    /**
+     * - Integer version for rawToMilliCelsius(), no 64-bit math:
+     *   - uniform: segment index estimated with the 16-bit step reciprocal
+     *     (16 x 16 bit partial products), corrected against index * step,
+     *     then a Q16 fraction from the remainder times the same reciprocal;
+     *     no division
+     *   - non-uniform: binary search on integer breakpoints, then a Q16
+     *     fraction from one 32-bit multiply by the segment reciprocal
+     *     (one 32-bit division instead without a reciprocals workspace)
+     * - Works in m°C: deltas * 10 + interpolated part (mulQ16(), 32-bit only).
+     */
+    if (!curve_points) return 0;
+
+    uint16_t last = curve_points - 1;
+    uint16_t i;
+    uint16_t frac;
+    int32_t dy;
+
+    if (!curve_x)
+    {
+        int32_t offset = tempMilliC - curve_x0_mc;
+        if (offset <= 0) return curve_y[0] * 10L;
+
+        uint32_t dx = (uint32_t)offset >> curve_step_shift;
+        if (dx >= curve_span_s) return curve_y[last] * 10L;
+
+        /** floor(dx * m / 2^s): dx < 2^31, so (dx >> 16) * m fits 31 bits */
+        uint32_t est = (dx >> 16) * curve_recip_m + (((dx & 0xFFFF) * curve_recip_m) >> 16);
+        i = (uint16_t)(est >> (curve_recip_s - 16));
+        if (i > last - 1) i = last - 1;
+
+        /** Rounded reciprocal: the estimate can be off by a few segments */
+        uint32_t base = (uint32_t)i * curve_step_s;
+        while (base > dx)
+        {
+            i--;
+            base -= curve_step_s;
+        }
+        while (dx - base >= curve_step_s && i < last - 1)
+        {
+            i++;
+            base += curve_step_s;
+        }
+
+        uint32_t f = ((dx - base) * curve_recip_m) >> (curve_recip_s - 16);
+        frac = (f > 0xFFFF) ? 0xFFFF : (uint16_t)f;
+        dy = (int32_t)(curve_y[i + 1] - curve_y[i]) * 10;
+        return curve_y[i] * 10L + mulQ16(dy, frac);
+    }
+
+    if (tempMilliC <= curve_x[0] * 100L) return curve_y[0] * 10L;
+    if (tempMilliC >= curve_x[last] * 100L) return curve_y[last] * 10L;
+
+    i = curveSegmentMilli(tempMilliC);
+
+    uint32_t d = tempMilliC - curve_x[i] * 100L;
+
+    if (curve_recip)
+    {
+        frac = (uint16_t)((d * curve_recip[i]) >> 16);
+    }
+    else
+    {
+        /** Q16 fraction; scale span below 2^15 so (d << 16) fits in 32 bits */
+        uint32_t span = (uint32_t)(curve_x[i + 1] - curve_x[i]) * 100;
+
+        while (span >= 0x8000UL)
+        {
+            span >>= 1;
+            d >>= 1;
+        }
+
+        if (d >= span) d = span - 1;
+        frac = (uint16_t)((d << 16) / span);
+    }
+
+    dy = (int32_t)(curve_y[i + 1] - curve_y[i]) * 10;
+
+    return curve_y[i] * 10L + mulQ16(dy, frac);
+}
+
+int32_t AD849x_7Semi::mulQ16(int32_t dy, uint16_t frac)
+{
+    /**
+     * - floor(dy * frac / 2^16) without a 64-bit product:
+     *   |dy| < 2^21 (int16 deltas * 10), so each 8-bit partial product
+     *   fits in 32 bits; nested floor division keeps the result exact.
+     */
+    int32_t hi = dy * (int32_t)(frac >> 8);
+    int32_t lo = (dy * (int32_t)(frac & 0xFF)) >> 8;
+
+    return (hi + lo) >> 8;
+}
+
+uint16_t AD849x_7Semi::curveSegmentMilli(int32_t tempMilliC)
+{
+    /**
+     * - curveSegment() on integer m°C: compares breakpoints * 100 directly.
+     */
+    uint16_t lo = 0;
+    uint16_t hi = curve_points - 1;
+
+    while (hi - lo > 1)
+    {
+        uint16_t mid = (lo + hi) >> 1;
+        if (curve_x[mid] * 100L <= tempMilliC) lo = mid;
+        else hi = mid;
+    }
+
+    return lo;
+}
+
+uint16_t AD849x_7Semi::curveSegment(float key10)
+{
+    /**
+     * - Binary search: largest i with breakpoints[i] <= key10 (0.1°C units).
+     * - Caller guarantees breakpoints[0] < key10 < breakpoints[last].
+     */
+    uint16_t lo = 0;
+    uint16_t hi = curve_points - 1;
+
+    while (hi - lo > 1)
+    {
+        uint16_t mid = (lo + hi) >> 1;
+        if (curve_x[mid] <= key10) lo = mid;
+        else hi = mid;
+    }
+
+    return lo;
+}
+
+/* ---------- Device Profiles ---------- */
+bool AD849x_7Semi::setDevice(AD849x_Device device, bool linearize)
+{
+    /**
+     * - One flash copy, member writes, one updateCoefficients() call
+     *   (instead of one per individual setter).
+     */
+    AD849x_DeviceProfile profile;
+    if (!getDeviceProfile(device, profile)) return false;
+
+    offset_voltage = profile.offset_voltage;
+    sensitivity = profile.sensitivity;
+    amplifier_gain = profile.amplifier_gain;
+    tc_type = linearize ? (AD849x_ThermocoupleType)profile.thermocouple : AD849X_TYPE_LINEAR;
+    device_id = device;
+
+    updateCoefficients();
+    return true;
+}
+
+AD849x_Device AD849x_7Semi::getDevice()
+{
+    return device_id;
+}
+
+bool AD849x_7Semi::getDeviceProfile(AD849x_Device device, AD849x_DeviceProfile &profile)
+{
+    if (device >= AD849X_DEVICE_COUNT) return false;
+
+    memcpy_P(&profile, &DEVICE_PROFILES[device], sizeof(profile));
+    return true;
+}
+
+/* ---------- Thermocouple Linearization ---------- */
+void AD849x_7Semi::setThermocoupleType(AD849x_ThermocoupleType type)
+{
+    tc_type = type;
+    updateCoefficients();
+}
+
+AD849x_ThermocoupleType AD849x_7Semi::getThermocoupleType()
+{
+    return tc_type;
+}
+
+void AD849x_7Semi::setAmplifierGain(float gain)
+{
+    /**
+     * - Thermocouple EMF to output gain of the AD849x (not the calibration gain).
+     */
+    if (gain <= 0) return;
+    amplifier_gain = gain;
+    updateCoefficients();
+}
+
+float AD849x_7Semi::emfToCelsius(AD849x_ThermocoupleType type, float emf_mV)
+{
+    /**
+     * - Picks the NIST segment containing emf_mV (clamped to the type's range)
+     *   and evaluates it with Horner's scheme: n multiplies + n adds.
+     */
+    uint8_t count;
+    const AD849x_FloatSegment *seg = floatSegments(type, count);
+    if (!seg) return NAN;
+
+    float lo = pgm_read_float(&seg[0].emf_min);
+    if (emf_mV < lo) emf_mV = lo;
+
+    uint8_t i = 0;
+    while (i + 1 < count && emf_mV > pgm_read_float(&seg[i].emf_max)) i++;
+
+    float hi = pgm_read_float(&seg[i].emf_max);
+    if (emf_mV > hi) emf_mV = hi;
+
+    uint8_t n = pgm_read_byte(&seg[i].order);
+    float t = pgm_read_float(&seg[i].d[n - 1]);
+
+    while (n > 1)
+    {
+        n--;
+        t = t * emf_mV + pgm_read_float(&seg[i].d[n - 1]);
+    }
+
+    return t;
+}
+
+int32_t AD849x_7Semi::emfToMilliCelsius(AD849x_ThermocoupleType type, int32_t emf_uV)
+{
+    return emfQ4ToMilliCelsius(type, emf_uV * 16);
+}
+
+int32_t AD849x_7Semi::emfQ4ToMilliCelsius(AD849x_ThermocoupleType type, int32_t emf_q4)
+{
+    /**
+     * - Integer Horner on rescaled coefficients (see table comment):
+     *   acc = q[n-1]; acc = ((acc * u) >> 30) + q[i] ...
+     * - emf_q4 is the EMF in 1/16 µV, so EMF quantization stays far below 1 m°C.
+     * - 32x32 -> 64-bit multiplies, no float, no division.
+     */
+    uint8_t count;
+    const AD849x_FixedSegment *seg = fixedSegments(type, count);
+    if (!seg) return 0;
+
+    int32_t lo = (int32_t)pgm_read_dword(&seg[0].emf_min) * 16;
+    if (emf_q4 < lo) emf_q4 = lo;
+
+    uint8_t i = 0;
+    while (i + 1 < count && emf_q4 > (int32_t)pgm_read_dword(&seg[i].emf_max) * 16) i++;
+
+    int32_t hi = (int32_t)pgm_read_dword(&seg[i].emf_max) * 16;
+    if (emf_q4 > hi) emf_q4 = hi;
+
+    uint8_t shift = pgm_read_byte(&seg[i].shift);
+    int32_t u = emf_q4 * ((int32_t)1 << (26 - shift));
+
+    uint8_t n = pgm_read_byte(&seg[i].order);
+    int32_t acc = (int32_t)pgm_read_dword(&seg[i].q[n - 1]);
+
+    while (n > 1)
+    {
+        n--;
+        acc = (int32_t)(((int64_t)acc * u) >> 30) + (int32_t)pgm_read_dword(&seg[i].q[n - 1]);
+    }
+
+    return (acc * 1000 + 512) >> 10;
+}
+
+float AD849x_7Semi::readCelsius()
+{
+    /**
+     * - Reads averaged ADC count and converts it to °C.
+     */
+    return rawToCelsius(readRaw());
+}
+
+float AD849x_7Semi::readFahrenheit()
+{
+    /**
+     * - Reads averaged ADC count and converts it to °F.
+     */
+    return rawToFahrenheit(readRaw());
+}
+
+float AD849x_7Semi::readKelvin()
+{
+    /**
+     * - Reads averaged ADC count and converts it to Kelvin.
+     */
+    return rawToKelvin(readRaw());
+}
+
+float AD849x_7Semi::rawToFahrenheit(int raw)
+{
+    /**
+     * - Linear: one multiply-add with the °F pair from updateCoefficients().
+     * - Table / linearization / curve produce °C first.
+     */
+    if (tc_type != AD849X_TYPE_LINEAR || curve_points || lutActive(raw))
+    {
+        return rawToCelsius(raw) * 1.8f + 32.0f;
+    }
+
+    return affine(coef_fa, (float)raw, coef_fb);
+}
+
+float AD849x_7Semi::rawToKelvin(int raw)
+{
+    if (tc_type != AD849X_TYPE_LINEAR || curve_points || lutActive(raw))
+    {
+        return rawToCelsius(raw) + 273.15f;
+    }
+
+    return affine(coef_a, (float)raw, coef_kb);
+}
+
+/* ---------- Lookup Table ---------- */
+bool AD849x_7Semi::setLookupTable(float *table, uint16_t entries)
+{
+    /**
+     * - Needs one entry per native code (resolution + 1).
+     */
+    if (!table || entries < (uint32_t)resolution + 1) return false;
+
+    lut_flash = nullptr;
+    lut_ram = table;
+    lut_entries = entries;
+    fillLookupTable(lut_ram, lut_entries);
+    return true;
+}
+
+bool AD849x_7Semi::setLookupTableP(const float *table, uint16_t entries)
+{
+    if (!table || entries < (uint32_t)resolution + 1) return false;
+
+    lut_ram = nullptr;
+    lut_flash = table;
+    lut_entries = entries;
+    return true;
+}
+
+void AD849x_7Semi::fillLookupTable(float *table, uint16_t entries)
+{
+    /**
+     * - Same math as rawToCelsius() without a table, at native scale.
+     * - With oversampling active, codes are scaled by 2^os_bits to stay native.
+     */
+    if (!table) return;
+
+    for (uint16_t code = 0; code < entries; code++)
+    {
+        table[code] = computeCelsius((int32_t)code << os_bits);
+    }
+}
+
+void AD849x_7Semi::clearLookupTable()
+{
+    lut_ram = nullptr;
+    lut_flash = nullptr;
+    lut_entries = 0;
+}
+
+bool AD849x_7Semi::lutActive(int raw)
+{
+    /**
+     * - Table is only valid for native codes inside its range.
+     */
+    return (lut_ram || lut_flash) && os_bits == 0 && raw >= 0 && raw < (int32_t)lut_entries;
+}
+
+float AD849x_7Semi::lutRead(int raw)
+{
+    return lut_ram ? lut_ram[raw] : pgm_read_float(lut_flash + raw);
+}
+
+/* ---------- Fixed-point Temperature ---------- */
+int32_t AD849x_7Semi::rawToMilliCelsius(int raw)
+{
+    /**
+     * - Linear: one 32-bit multiply, one add, one arithmetic shift.
+     * - Linearized: same affine step to EMF (1/16 µV), then integer NIST Horner.
+     * - Rounding to nearest is folded into the b coefficients.
+     */
+    int32_t mc;
+
+    if (tc_type == AD849X_TYPE_LINEAR)
+    {
+        mc = ((int32_t)raw * fx_a + fx_b) >> fx_shift;
+    }
+    else
+    {
+        mc = emfQ4ToMilliCelsius(tc_type, ((int32_t)raw * fe_a + fe_b) >> fe_shift);
+        if (gain_q16 != 65536) mc = (int32_t)(((int64_t)mc * gain_q16) >> 16);
+        mc += offset_mc;
+    }
+
+    if (curve_points) mc += curveCorrectionMilli(mc);
+    return mc;
+}
+
+int32_t AD849x_7Semi::readMilliCelsius()
+{
+    return rawToMilliCelsius(readRaw());
+}
+
+int32_t AD849x_7Semi::rawToMilliFahrenheit(int raw)
+{
+    /**
+     * - Linear: Q-format °F pair, same form as rawToMilliCelsius().
+     * - Otherwise: m°F = m°C * 9 / 5 + 32000, rounded to nearest.
+     */
+    if (tc_type == AD849X_TYPE_LINEAR && !curve_points)
+    {
+        return ((int32_t)raw * fxf_a + fxf_b) >> fxf_shift;
+    }
+
+    int32_t mc = rawToMilliCelsius(raw) * 9;
+    return (mc >= 0 ? (mc + 2) / 5 : (mc - 2) / 5) + 32000;
+}
+
+int32_t AD849x_7Semi::rawToMilliKelvin(int raw)
+{
+    return rawToMilliCelsius(raw) + 273150;
+}
+
+uint16_t AD849x_7Semi::getMilliCelsiusErrorBound()
+{
+    /**
+     * - Linear: 0.5 m°C final rounding + 0.5 m°C from b_q
+     *   + raw * 0.5 LSB of a_q (at full scale).
+     * - Linearized: EMF error (same rule, in 1/16 µV) times a worst-case
+     *   slope of 100 m°C/µV, plus 4 m°C polynomial evaluation error.
+     * - Curve: input error * (1 + steepest slope), plus 1 m°C + dy / 2^14
+     *   from the Q16 segment fraction.
+     */
+    uint32_t error;
+
+    if (tc_type == AD849X_TYPE_LINEAR)
+    {
+        error = 1 + (((uint32_t)effective_resolution + (2UL << fx_shift) - 1) >> (fx_shift + 1));
+    }
+    else
+    {
+        uint32_t emfError = 1 + (((uint32_t)effective_resolution + (2UL << fe_shift) - 1) >> (fe_shift + 1));
+        error = 4 + (emfError * 100 + 15) / 16;
+    }
+
+    if (curve_points)
+    {
+        error += (error * curve_dy_max_mc + curve_dx_min_mc - 1) / curve_dx_min_mc;
+        error += 1 + (curve_dy_max_mc >> 14);
+    }
+
+    return error > 0xFFFF ? 0xFFFF : (uint16_t)error;
+}
+
+void AD849x_7Semi::quantize(float a, float b, uint16_t maxRaw, int32_t &qa, int32_t &qb, uint8_t &shift)
+{
+    /**
+     * - Q-format for y = a * raw + b with raw in 0 .. maxRaw:
+     *   - largest shift (<= 24) so that |a_q| * maxRaw + |b_q| < 2^31
+     *   - rounding offset (0.5 LSB of the result) folded into b_q
+     */
+    float span = fabsf(a) * maxRaw + fabsf(b) + 1.0f;
+    shift = 24;
+
+    while (shift && span * (float)(1UL << shift) >= 2147483648.0f)
+    {
+        shift--;
+    }
+
+    float scale = (float)(1UL << shift);
+    qa = lroundf(a * scale);
+    qb = lroundf(b * scale) + (shift ? (1L << (shift - 1)) : 0);
+}
+
+void AD849x_7Semi::updateCoefficients()
+{
+    /**
+     * - Folds rawToVoltage() and voltageToCelsius() into one affine map:
+     *   tempC = a * raw + b
+     *   a = gain * Vref / (effective_resolution * sensitivity)
+     *   b = offset - offset_voltage * gain / sensitivity
+     * - Float pair for rawToCelsius() / convertBlock().
+     * - Q-format pair in m°C for rawToMilliCelsius().
+     * - Unit pairs: °F (float and Q-format) and K offset, so rawToFahrenheit()
+     *   and rawToKelvin() stay one multiply-add.
+     * - Linearization pairs (thermocouple EMF):
+     *   emf_mV = raw * Vref * 1000 / (effective_resolution * amplifier_gain)
+     *            - offset_voltage * 1000 / amplifier_gain
+     * - Runs only when a setter changes an input, never per reading.
+     */
+    if (sensitivity == 0 || effective_resolution == 0) return;
+
+    float k = gain / sensitivity;
+    coef_a = k * reference_voltage / effective_resolution;
+    coef_b = offset - offset_voltage * k;
+
+    quantize(1000.0f * coef_a, 1000.0f * coef_b, effective_resolution, fx_a, fx_b, fx_shift);
+
+    float m = 1000.0f / amplifier_gain;
+    emf_a = m * reference_voltage / effective_resolution;
+    emf_b = -offset_voltage * m;
+
+    quantize(16000.0f * emf_a, 16000.0f * emf_b, effective_resolution, fe_a, fe_b, fe_shift);
+
+    coef_fa = 1.8f * coef_a;
+    coef_fb = 1.8f * coef_b + 32.0f;
+    coef_kb = coef_b + 273.15f;
+
+    quantize(1800.0f * coef_a, 1800.0f * coef_b + 32000.0f, effective_resolution, fxf_a, fxf_b, fxf_shift);
+
+    gain_q16 = lroundf(gain * 65536.0f);
+    offset_mc = lroundf(offset * 1000.0f);
+
+    if (lut_ram) fillLookupTable(lut_ram, lut_entries);
+    if (trip_enabled) updateTrip();
+}
+
+/* ---------- Inverse Conversion ---------- */
+float AD849x_7Semi::celsiusToVoltage(float tempC)
+{
+    /**
+     * - voltageToCelsius() is increasing in voltage, so bisection converges
+     *   for any linearization / curve combination.
+     */
+    if (tc_type == AD849X_TYPE_LINEAR && !curve_points)
+    {
+        return (tempC - offset) / gain * sensitivity + offset_voltage;
+    }
+
+    float lo = 0;
+    float hi = reference_voltage;
+
+    for (uint8_t i = 0; i < 24; i++)
+    {
+        float mid = 0.5f * (lo + hi);
+        if (voltageToCelsius(mid) < tempC) lo = mid;
+        else hi = mid;
+    }
+
+    return hi;
+}
+
+int32_t AD849x_7Semi::celsiusToRaw(float tempC)
+{
+    /**
+     * - Predicate: rawToCelsius(raw) >= tempC.
+     * - Linear: start from ceil((tempC - b) / a), then walk to the exact edge
+     *   (float rounding can move it by one count).
+     * - Otherwise: binary search.
+     */
+    int32_t maxRaw = effective_resolution;
+
+    if (rawToCelsius(maxRaw) < tempC) return maxRaw + 1;
+    if (rawToCelsius(0) >= tempC) return 0;
+
+    int32_t raw;
+
+    if (tc_type == AD849X_TYPE_LINEAR && !curve_points && coef_a > 0)
+    {
+        raw = (int32_t)ceilf((tempC - coef_b) / coef_a);
+        if (raw < 1) raw = 1;
+        if (raw > maxRaw) raw = maxRaw;
+
+        while (raw > 1 && rawToCelsius(raw - 1) >= tempC) raw--;
+        while (raw < maxRaw && rawToCelsius(raw) < tempC) raw++;
+
+        return raw;
+    }
+
+    int32_t lo = 0;
+    int32_t hi = maxRaw;
+
+    while (hi - lo > 1)
+    {
+        raw = (lo + hi) >> 1;
+        if (rawToCelsius(raw) >= tempC) hi = raw;
+        else lo = raw;
+    }
+
+    return hi;
+}
+
+/* ---------- Over-temperature Trip ---------- */
+void AD849x_7Semi::setOverTemperatureTrip(float tempC, AD849x_TripCallback callback, void *context)
+{
+    trip_celsius = tempC;
+    trip_callback = callback;
+    trip_context = context;
+    trip_enabled = true;
+    tripped = false;
+    trip_run = 0;
+
+    updateTrip();
+}
+
+void AD849x_7Semi::setTripDebounce(uint8_t samples)
+{
+    noInterrupts();
+    trip_samples = samples ? samples : 1;
+    trip_run = 0;
+    interrupts();
+}
+
+void AD849x_7Semi::clearOverTemperatureTrip()
+{
+    noInterrupts();
+    trip_enabled = false;
+    trip_armed = false;
+    trip_native = 0xFFFF;
+    trip_decimated = 0xFFFFFFFF;
+    trip_raw = 0;
+    trip_run = 0;
+    tripped = false;
+    interrupts();
+}
+
+bool AD849x_7Semi::isTripped()
+{
+    return tripped;
+}
+
+void AD849x_7Semi::resetTrip()
+{
+    noInterrupts();
+    trip_run = 0;
+    tripped = false;
+    interrupts();
+}
+
+uint16_t AD849x_7Semi::getTripRaw()
+{
+    return trip_raw;
+}
+
+void AD849x_7Semi::updateTrip()
+{
+    /**
+     * - trip_raw: readRaw() scale (effective counts).
+     * - trip_native: pushSample() scale, ceil(trip_raw / 2^os_bits).
+     * - trip_decimated: smallest CIC rawOutput() that acquire() would round
+     *   to >= trip_raw, ceil((2 trip_raw - 1) * gain / 2^(os_bits + 1)).
+     *   The 64-bit product runs here only, never in the ISR.
+     * - Disarmed when the threshold is above full scale (can never trip).
+     * - Updated with interrupts off so the ISR never sees a half-written value.
+     */
+    int32_t raw = celsiusToRaw(trip_celsius);
+    bool reachable = raw <= (int32_t)effective_resolution;
+
+    uint32_t decimated = 0xFFFFFFFF;
+    if (reachable && decimator)
+    {
+        uint8_t shift = os_bits + 1;
+        uint64_t limit = raw ? ((uint64_t)(2 * raw - 1) * decimator->getGain() + ((1ULL << shift) - 1)) >> shift : 0;
+        if (limit < 0xFFFFFFFFULL) decimated = (uint32_t)limit;
+    }
+
+    noInterrupts();
+    trip_armed = reachable;
+    trip_raw = reachable ? (uint16_t)raw : 0;
+    trip_native = reachable ? (uint16_t)((raw + (1L << os_bits) - 1) >> os_bits) : 0xFFFF;
+    trip_decimated = decimated;
+    interrupts();
+}
+
+void AD849x_7Semi::trip()
+{
+    /**
+     * - Latches and runs the callback once.
+     */
+    tripped = true;
+    if (trip_callback) trip_callback(trip_context);
+}
+
+/* ---------- Calibration ---------- */
+void AD849x_7Semi::calibrate(float actualTempC)
+{
+    /**
+     * - Simple 1-point calibration.
+     * - Measures current temperature and adjusts internal offset so that:
+     *   measured + offset == actualTempC
+     *
+     * Usage example:
+     * - Put thermocouple in a known stable temperature point
+     *   (e.g., ice bath ~0°C, boiling water ~100°C at sea level),
+     *   then call calibrate(knownTempC).
+     * - Always uses a fresh acquisition (cache is bypassed).
+     */
+    invalidateCache();
+    float measured = readCelsius();
+    offset = actualTempC - measured;
+    updateCoefficients();
+}
+
+/* ---------- Filtering ---------- */
+float AD849x_7Semi::readFilteredTemperatureC(float alpha)
+{
+    /**
+     * - Exponential moving average (IIR low-pass filter).
+     * - alpha range:
+     *   - 1.0 : no filtering (output follows current reading)
+     *   - 0.0 : output never changes (not useful)
+     *   - Typical: 0.05 to 0.3 depending on noise and response needed
+     *
+     * Formula:
+     *   filtered = alpha * current + (1 - alpha) * previous_filtered
+     *
+     * Notes:
+     * - On first call, it initializes filter output to the current reading.
+     */
+    return updateFilter(readCelsius(), alpha);
+}
+
+float AD849x_7Semi::updateFilter(float current, float alpha)
+{
+    /**
+     * - Shared EMA step used by readFilteredTemperatureC() and read().
+     */
+    if (isnan(filtered_temperature))
+    {
+        filtered_temperature = current;
+    }
+
+    filtered_temperature = alpha * current + (1.0f - alpha) * filtered_temperature;
+    return filtered_temperature;
+}
+
+/* ---------- Snapshot ---------- */
+AD849x_7Semi::Measurement AD849x_7Semi::read(float alpha)
+{
+    /**
+     * - One readRaw() call; every other field is pure math on that value.
+     * - Fields therefore describe the same instant, and ADC time is one
+     *   acquisition instead of six.
+     */
+    Measurement m;
+
+    m.raw = readRaw();
+    m.voltage = rawToVoltage(m.raw);
+    m.celsius = rawToCelsius(m.raw);
+    m.fahrenheit = rawToFahrenheit(m.raw);
+    m.kelvin = rawToKelvin(m.raw);
+    m.filtered = updateFilter(m.celsius, alpha);
+    m.status = voltageInRange(m.voltage);
+
+    return m;
+}
+
+/* ---------- Diagnostics ---------- */
 uint8_t AD849x_7Semi::FaultDetect()
 {
     /**
@@ -278,6 +2028,113 @@ uint8_t AD849x_7Semi::FaultDetect()
      *   and breakout board design.
      * - Use this as a quick health check, not a safety-critical detector.
      */
-    float v = readVoltage();
-    return (v > 0.1 && v < (reference_voltage - 0.1));
+    return voltageInRange(readVoltage());
+}
+
+uint8_t AD849x_7Semi::voltageInRange(float voltage)
+{
+    /**
+     * - Shared sanity window used by FaultDetect() and read().
+     */
+    return (voltage > 0.1f && voltage < (reference_voltage - 0.1f));
+}
+
+/* ---------- Fixed-rate Sampling ---------- */
+void AD849xScheduler_7Semi::setSampleRate(float hz)
+{
+    /**
+     * - Converts rate to a period in µs; the first sample is taken on the next update().
+     */
+    if (hz <= 0)
+    {
+        sample_rate = 0;
+        sample_period_us = 0;
+    }
+    else
+    {
+        sample_rate = hz;
+        sample_period_us = (uint32_t)(1000000.0f / hz + 0.5f);
+        if (sample_period_us == 0) sample_period_us = 1;
+    }
+
+    paced_started = false;
+    resetJitterStats();
+}
+
+float AD849xScheduler_7Semi::getSampleRate()
+{
+    return sample_rate;
+}
+
+bool AD849xScheduler_7Semi::update(float alpha)
+{
+    /**
+     * - Deadline scheduler:
+     *   - sample when (now - next_deadline) >= 0 (wrap-safe signed compare)
+     *   - next_deadline += period (no drift)
+     *   - if more than one period late, deadlines are skipped and counted as missed
+     * - Jitter = |measured interval - period| between consecutive sample starts.
+     */
+    if (sample_period_us == 0) return false;
+
+    uint32_t now = micros();
+
+    if (!paced_started)
+    {
+        paced_started = true;
+        next_deadline_us = now;
+    }
+
+    if ((int32_t)(now - next_deadline_us) < 0) return false;
+
+    if (have_last_sample)
+    {
+        uint32_t interval = now - last_sample_us;
+        uint32_t dev = (interval > sample_period_us) ? (interval - sample_period_us)
+                                                     : (sample_period_us - interval);
+
+        if (jitter.samples == 0 || dev < jitter.minUs) jitter.minUs = dev;
+        if (dev > jitter.maxUs) jitter.maxUs = dev;
+
+        jitter_sum_us += dev;
+        jitter.samples++;
+    }
+
+    last_sample_us = now;
+    have_last_sample = true;
+
+    next_deadline_us += sample_period_us;
+    while ((int32_t)(now - next_deadline_us) >= 0)
+    {
+        next_deadline_us += sample_period_us;
+        jitter.missed++;
+    }
+
+    paced_measurement = thermo.read(alpha);
+    return true;
+}
+
+AD849x_7Semi::Measurement AD849xScheduler_7Semi::getMeasurement()
+{
+    return paced_measurement;
+}
+
+AD849xScheduler_7Semi::JitterStats AD849xScheduler_7Semi::getJitterStats()
+{
+    /**
+     * - meanUs is computed on request from the running sum.
+     */
+    JitterStats stats = jitter;
+    stats.meanUs = stats.samples ? (float)jitter_sum_us / stats.samples : 0;
+    return stats;
+}
+
+void AD849xScheduler_7Semi::resetJitterStats()
+{
+    /**
+     * - Next interval starts from the next sample, not from the old timestamp.
+     */
+    jitter = JitterStats();
+    jitter_sum_us = 0;
+    have_last_sample = false;
 }
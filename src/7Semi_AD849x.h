@@ -11,6 +11,7 @@
  *
  * IMPORTANT:
  * - offset_voltage and sensitivity depend on the exact IC/module. Verify from datasheet/module.
+ * - setDevice(AD8495_K) etc. applies a built-in variant profile in one step.
  * - adcResolution in begin() must be ADC maximum count (not "bits"):
  *   - 10-bit: 1023
  *   - 12-bit: 4095
@@ -21,12 +22,133 @@
 #ifndef _7SEMI_AD849X_H_
 #define _7SEMI_AD849X_H_
 
+/**
+ * - AD849X_HOST_BUILD (opt-in, e.g. -DAD849X_HOST_BUILD): build on a PC
+ *   against the stand-ins in 7Semi_AD849x_host.h instead of an Arduino core.
+ */
+#if defined(AD849X_HOST_BUILD)
+#include "7Semi_AD849x_host.h"
+#else
 #include <Arduino.h>
+#endif
+
+/* ---------- Flash Access ---------- */
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#ifndef pgm_read_float
+#define pgm_read_float(addr) (*(const float *)(addr))
+#endif
+
+#ifndef pgm_read_byte
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#endif
+
+#ifndef pgm_read_dword
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#endif
+
+#ifndef memcpy_P
+#include <string.h>
+#define memcpy_P memcpy
+#endif
+
+/* ---------- Thermocouple Types ---------- */
+/**
+ * AD849x_ThermocoupleType
+ * - Selects the NIST ITS-90 inverse polynomial used to linearize the output.
+ * - AD849X_TYPE_LINEAR keeps the plain linear transfer (default).
+ */
+enum AD849x_ThermocoupleType : uint8_t
+{
+    AD849X_TYPE_LINEAR = 0,
+    AD849X_TYPE_K,
+    AD849X_TYPE_J,
+    AD849X_TYPE_T,
+    AD849X_TYPE_E,
+    AD849X_TYPE_N
+};
+
+/* ---------- Device Profiles ---------- */
+/**
+ * AD849x_Device
+ * - AD849x variants with a built-in profile (see setDevice()).
+ * - AD8494 / AD8496: J-type, AD8495 / AD8497: K-type.
+ * - AD8496 / AD8497 are the variants trimmed for a higher cold-junction range.
+ */
+enum AD849x_Device : uint8_t
+{
+    AD8494_J = 0,
+    AD8495_K,
+    AD8496_J,
+    AD8497_K,
+    AD849X_DEVICE_COUNT
+};
+
+/**
+ * AD849x_DeviceProfile
+ * - Coefficients applied in one step by setDevice().
+ * - offset_voltage is the output at 0°C, i.e. the REF pin voltage of the module
+ *   (1.25V on 7Semi and most breakout boards).
+ */
+struct AD849x_DeviceProfile
+{
+    float offset_voltage;       // V at 0°C (REF voltage)
+    float sensitivity;          // V/°C
+    float amplifier_gain;       // Thermocouple EMF -> output gain
+    uint8_t thermocouple;       // AD849x_ThermocoupleType matching the variant
+};
+
+/* ---------- ADC Hook ---------- */
+/**
+ * ad849xReadADC(pin)
+ * - Every conversion of AD849x_7Semi, AD849xArray_7Semi and
+ *   AD849xStatic_7Semi comes from this function.
+ * - The library ships a weak default that returns analogRead(pin).
+ * - For an external ADC, a DMA buffer or a simulated source, define
+ *   uint16_t ad849xReadADC(uint8_t pin) once in the sketch; the linker
+ *   uses it instead of the default.
+ * - Resolved at link time: no pointer in any object, no per-sample branch,
+ *   and the class layout is the same whichever definition is used.
+ *
+ * Example (host test):
+ *   AD849xMockADC_7Semi mock;
+ *   uint16_t ad849xReadADC(uint8_t pin) { return mock.read(pin); }
+ */
+uint16_t ad849xReadADC(uint8_t pin);
+
+/* ---------- Over-temperature Trip ---------- */
+/**
+ * AD849x_TripCallback
+ * - Called once when the over-temperature trip fires (see setOverTemperatureTrip()).
+ * - Runs in the caller of pushSample() / readRaw(), i.e. possibly inside an ISR:
+ *   keep it short (set a pin, disable a heater output).
+ */
+typedef void (*AD849x_TripCallback)(void *context);
+
+class AD849xCIC_7Semi;
 
 /* ---------- AD849x Class ---------- */
 class AD849x_7Semi
 {
 public:
+    /* ---------- Measurement Snapshot ---------- */
+    /**
+     * Measurement
+     * - Result of read(): every field is derived from ONE averaged acquisition.
+     */
+    struct Measurement
+    {
+        int raw;            // Averaged ADC count
+        float voltage;      // Amplifier output in volts
+        float celsius;      // Temperature in °C
+        float fahrenheit;   // Temperature in °F
+        float kelvin;       // Temperature in K
+        float filtered;     // EMA filtered temperature in °C
+        uint8_t status;     // 1 = output within valid window, 0 = fault (same as FaultDetect())
+    };
+
     /* ---------- Constructor ---------- */
     AD849x_7Semi();
 
@@ -85,27 +207,171 @@ public:
     /**
      * setSampling(samples)
      * - Sets number of ADC samples used for averaging in readRaw().
-     * - Range clamped:
+     * - Range:
      *   - minimum: 1
-     *   - maximum: 200
-     * - Higher value reduces noise but increases read time.
+     *   - maximum: 65535 (accumulation is 32-bit, safe even for 16-bit ADCs)
+     * - Higher value reduces noise but increases read time
+     *   (use startConversion()/poll() or setSamplingBudgetUs() for large windows).
      */
-    void setSampling(uint8_t samples);
+    void setSampling(uint16_t samples);
 
     /**
      * getSampling()
      * - Returns the current averaging sample count used by readRaw().
      */
-    uint8_t getSampling();
+    uint16_t getSampling();
+
+    /**
+     * setSamplingBudgetUs(us)
+     * - Time-budgeted averaging: keeps sampling until `us` microseconds elapsed,
+     *   so a read always fits a fixed control-loop slot whatever the ADC speed
+     *   (AVR ~112 µs, SAMD / ESP32 much faster per analogRead()).
+     * - At least 1 and at most 65535 samples are taken per reading.
+     * - Overrides setSampling() and the 4^n window of setOversampling() while
+     *   active (extra bits are still applied to the result).
+     * - For poll(), the budget is measured from the start of each window.
+     * - us = 0 disables the budget (default, fixed sample count).
+     */
+    void setSamplingBudgetUs(uint32_t us);
+
+    /**
+     * getSamplingBudgetUs()
+     * - Returns the time budget in µs (0 = disabled).
+     */
+    uint32_t getSamplingBudgetUs();
+
+    /**
+     * getLastSampleCount()
+     * - Number of ADC samples used by the last completed readRaw() acquisition.
+     */
+    uint16_t getLastSampleCount();
+
+    /**
+     * getSampleVariance()
+     * - Variance of the individual ADC samples (native counts^2) within the
+     *   last acquisition.
+     * - 0 when the last reading had a single sample or came from the CIC
+     *   decimator (no per-sample data); never carried over from older readings.
+     * - Tracked in the acquisition loop with integer sums (no extra ADC reads).
+     */
+    float getSampleVariance();
+
+    /**
+     * getMeasurementVarianceC()
+     * - Noise variance (°C^2) of the last averaged reading, from the sample
+     *   variance, ADC quantization (1/12 count^2) and the number of samples.
+     * - Feed it to AD849xKalman_7Semi::update() as the measurement noise.
+     */
+    float getMeasurementVarianceC();
+
+    /**
+     * setOversampling(extraBits)
+     * - Oversampling and decimation for extra effective ADC resolution.
+     * - Each reading takes 4^extraBits samples and keeps extraBits extra bits:
+     *   - readRaw() returns counts in 0 .. getEffectiveResolution()
+     *   - rawToVoltage() scales by the effective resolution automatically
+     * - extraBits = 0 disables oversampling (plain avg_sample averaging).
+     * - Clamped so the effective max count fits an int on every target (<= 32767):
+     *   - 10-bit ADC: up to 5 extra bits (15 effective bits, 1024 samples)
+     *   - 12-bit ADC: up to 3 extra bits (15 effective bits, 64 samples)
+     * - Buffered mode (setBufferedMode(), no decimator): also clamped so the
+     *   4^extraBits window fits the ring buffer (size - 1 samples), i.e. up
+     *   to 3 extra bits with a 128-entry buffer, 2 with 32, none without one.
+     *   The requested value is kept and re-applied when the buffer or mode
+     *   changes.
+     * - Extra bits are only real if the input carries ~1 LSB of noise (dither).
+     */
+    void setOversampling(uint8_t extraBits);
+
+    /**
+     * getOversampling()
+     * - Returns the number of extra bits in use (after clamping).
+     */
+    uint8_t getOversampling();
+
+    /**
+     * getEffectiveResolution()
+     * - Returns the max count of readRaw() results: resolution << extraBits.
+     * - Equals the ADC max count when oversampling is disabled.
+     */
+    uint16_t getEffectiveResolution();
 
     /* ---------- Reading ---------- */
     /**
      * readRaw()
      * - Reads analog input multiple times (avg_sample) and returns averaged ADC count.
-     * - Output range: 0 to resolution (depending on ADC).
+     * - Output range: 0 .. getEffectiveResolution(), i.e. 0 .. resolution
+     *   by default and 0 .. resolution << k after setOversampling(k).
      */
     int readRaw();
 
+    /**
+     * readRawMean()
+     * - Same acquisition as readRaw() but returns the average as float, keeping
+     *   the fractional bits an integer average would drop.
+     * - Same scale as readRaw(): 0 .. resolution << k with setOversampling(k),
+     *   not native ADC counts; pass it to rawToVoltage(float).
+     */
+    float readRawMean();
+
+    /* ---------- Block Acquisition ---------- */
+    /**
+     * readRawBlock(dst, n)
+     * - Fills a caller-owned buffer with n single (not averaged) ADC samples,
+     *   back-to-back at the fastest analogRead() rate.
+     * - Samples are native ADC counts (0..resolution), not oversampled.
+     * - Bypasses cache, averaging and buffered mode.
+     * - Returns number of samples written.
+     */
+    size_t readRawBlock(uint16_t *dst, size_t n);
+
+    /**
+     * convertBlock(src, dstC, n)
+     * - Converts n native ADC counts (e.g. from readRawBlock()) to °C.
+     * - Same cached affine transform as rawToCelsius() (scaled for native counts),
+     *   one multiply-add per sample in a tight loop (no per-sample calls).
+     * - src and dstC are caller-owned.
+     */
+    void convertBlock(const uint16_t *src, float *dstC, size_t n);
+
+    /* ---------- Reading Cache ---------- */
+    /**
+     * setCacheMaxAge(maxAgeMs)
+     * - Enables a reading cache shared by every read*() getter.
+     * - readRaw() returns the last acquired value while it is younger than maxAgeMs
+     *   and only performs a new acquisition when the cached value is stale.
+     * - maxAgeMs = 0 disables the cache (default, every call acquires).
+     * - Useful when several modules (display, logger, PID) ask for the
+     *   temperature within the same few milliseconds.
+     */
+    void setCacheMaxAge(uint32_t maxAgeMs);
+
+    /**
+     * getCacheMaxAge()
+     * - Returns the configured maximum cache age in ms (0 = disabled).
+     */
+    uint32_t getCacheMaxAge();
+
+    /**
+     * invalidateCache()
+     * - Forces the next readRaw() to acquire a fresh value.
+     */
+    void invalidateCache();
+
+    /**
+     * getCacheHits() / getCacheMisses()
+     * - Number of readRaw() calls served from the cache / by a new acquisition
+     *   while the cache is enabled. Use them to tune maxAgeMs.
+     */
+    uint32_t getCacheHits();
+    uint32_t getCacheMisses();
+
+    /**
+     * resetCacheStats()
+     * - Clears the hit and miss counters.
+     */
+    void resetCacheStats();
+
     /**
      * rawToVoltage(raw)
      * - Converts ADC count to voltage using:
@@ -113,6 +379,139 @@ public:
      */
     float rawToVoltage(int raw);
 
+    /**
+     * rawToVoltage(rawMean)
+     * - Float overload for readRawMean() results (fractional counts).
+     */
+    float rawToVoltage(float rawMean);
+
+    /* ---------- Non-blocking Acquisition ---------- */
+    /**
+     * startConversion(continuous)
+     * - Starts a non-blocking averaged acquisition of avg_sample ADC samples
+     *   (or for the sampling time budget, if set).
+     * - Samples are taken one at a time by poll(), so loop() never stalls.
+     * - continuous = true restarts a new window automatically after each result.
+     * - Calling it while a window is running restarts the window.
+     */
+    void startConversion(bool continuous = false);
+
+    /**
+     * poll()
+     * - Takes at most one ADC sample for the running acquisition.
+     * - Call it as often as possible from loop().
+     * - Returns true when the window completed and a new result was published.
+     * - Does nothing (returns false) when no acquisition is running.
+     */
+    bool poll();
+
+    /**
+     * available()
+     * - Returns true when a published result has not yet been read with getConversion().
+     */
+    bool available();
+
+    /**
+     * getConversion()
+     * - Returns the last published averaged ADC count (same scale as readRaw()).
+     * - Clears the available() flag.
+     * - Convert with rawToVoltage() / voltageToCelsius() as usual.
+     */
+    int getConversion();
+
+    /**
+     * isConverting()
+     * - Returns true while an acquisition window is in progress.
+     */
+    bool isConverting();
+
+    /* ---------- Buffered (ISR) Acquisition ---------- */
+    /**
+     * setBuffer(buf, size)
+     * - Gives the ISR ring buffer its storage; objects that never use
+     *   pushSample() buffering carry no sample array.
+     * - size: power of two, 2 .. 128 (8-bit indices for atomic access on AVR);
+     *   holds up to size - 1 samples.
+     * - buf must outlive its use; nullptr detaches (pushSample() then drops samples).
+     * - Returns false (and keeps the current buffer) for an invalid size.
+     * - Clears the buffer.
+     *
+     * Example:
+     *   static uint16_t samples[32];
+     *   thermo.setBuffer(samples, 32);
+     *   thermo.setBufferedMode(true);
+     */
+    bool setBuffer(uint16_t *buf, uint8_t size);
+
+    /**
+     * setBufferedMode(enable)
+     * - enable = true:
+     *   - readRaw() (and everything built on it: readVoltage(), readCelsius(),
+     *     readFilteredTemperatureC(), ...) consumes samples pushed by pushSample()
+     *     instead of calling analogRead().
+     *   - Averages the newest min(avg_sample, buffered) samples and drains the buffer.
+     *   - If no new sample arrived since the last read, the previous result is returned.
+     * - enable = false: back to synchronous analogRead() averaging.
+     * - Enabling clears the ring buffer; attach one with setBuffer() first.
+     */
+    void setBufferedMode(bool enable);
+
+    /**
+     * pushSample(sample)
+     * - Producer side of the ring buffer, safe to call from an ADC or timer ISR.
+     * - When the buffer is full the oldest sample is overwritten; without a
+     *   buffer (setBuffer()) or decimator the sample is dropped.
+     * - On a host build, call it from a simulated interrupt source to feed data.
+     *
+     * Example (AVR, free-running ADC):
+     *   ISR(ADC_vect) { thermo.pushSample(ADC); }
+     */
+    void pushSample(uint16_t sample);
+
+    /**
+     * bufferedCount()
+     * - Returns number of samples waiting in the ring buffer.
+     */
+    uint8_t bufferedCount();
+
+    /**
+     * setDecimator(cic)
+     * - Routes pushSample() into a CIC decimator (AD849xCIC_7Semi) instead of
+     *   the ring buffer: no samples stored, adds only in the ISR.
+     * - The ISR only latches each raw comb output into a volatile value;
+     *   readRaw() removes the CIC gain and scales it to effective counts
+     *   (setOversampling() bits come from the CIC's extra precision), so no
+     *   division ever runs in interrupt context.
+     * - readRaw() returns it instead of a blocking burst average, and
+     *   rawToVoltage() / voltageToCelsius() / readCelsius() work unchanged.
+     * - readRaw() keeps the previous result until the next output arrives.
+     * - Start-up: until the first CIC output, readRaw() returns the latest
+     *   single sample (getLastSampleCount() == 1) rather than 0; with no
+     *   sample pushed yet it waits up to 100 ms for one.
+     * - cic must be configured first and outlive its use; nullptr disables.
+     * - Returns false (decimator unchanged) if the CIC's inputBits cannot hold
+     *   the ADC resolution of begin().
+     */
+    bool setDecimator(AD849xCIC_7Semi *cic);
+
+#if defined(__AVR__)
+    /**
+     * startFreeRunningADC(prescaler)
+     * - AVR only: puts the ADC in free-running mode on analog_pin with the
+     *   conversion-complete interrupt enabled.
+     * - prescaler: ADPS bits (7 = /128, ~9.6 kS/s at 16 MHz).
+     * - The sketch must provide ISR(ADC_vect) calling pushSample(ADC).
+     * - analogRead() must not be used while free-running.
+     */
+    void startFreeRunningADC(uint8_t prescaler = 7);
+
+    /**
+     * stopFreeRunningADC()
+     * - AVR only: stops free-running mode and restores analogRead() settings.
+     */
+    void stopFreeRunningADC();
+#endif
+
     /**
      * readVoltage()
      * - Reads averaged ADC and returns the measured voltage in volts.
@@ -129,26 +528,331 @@ public:
      */
     float voltageToCelsius(float voltage);
 
+    /**
+     * rawToCelsius(raw)
+     * - Converts an ADC count (readRaw() scale) straight to °C with the cached
+     *   affine transform:
+     *   tempC = a * raw + b
+     * - a and b fold rawToVoltage() and voltageToCelsius() together and are
+     *   recomputed by setVref(), setADCResolution(), setOffsetVoltage(),
+     *   setSensitivity(), setOversampling(), begin() and calibrate().
+     * - One multiply-add instead of two divisions, two multiplies and two add/sub.
+     */
+    float rawToCelsius(int raw);
+
+    /**
+     * rawToCelsius(src, dstC, n)
+     * - Batch version for captured traces (readRaw() scale counts).
+     * - Vectorized with SSE2 / AVX2 on x86 and NEON on ARM A-profile; scalar
+     *   (unrolled) elsewhere, including Cortex-M4/M7 where floats are scalar only.
+     * - Bit-identical to calling rawToCelsius(raw) for each element.
+     * - With a lookup table, linearization or correction curve it runs the
+     *   per-sample path.
+     * - src and dstC are caller-owned.
+     */
+    void rawToCelsius(const uint16_t *src, float *dstC, size_t n);
+
     /**
      * readCelsius()
-     * - Reads voltage from ADC and returns temperature in °C.
+     * - Reads averaged ADC and returns temperature in °C.
      */
     float readCelsius();
 
+    /* ---------- Lookup Table ---------- */
+    /**
+     * setLookupTable(table, entries)
+     * - Attaches a caller-owned RAM table mapping every native ADC code to °C.
+     * - entries must be >= resolution + 1 (1024 for 10-bit, 4096 for 12-bit).
+     * - The table is filled immediately and rebuilt whenever coefficients change
+     *   (setters, calibrate()), with every correction stage folded in.
+     * - rawToCelsius() / readCelsius() / convertBlock() then do a single indexed load.
+     * - Used only without oversampling (extended codes do not index the table).
+     * - Returns false (table not attached) if entries is too small.
+     * - RAM: 4 bytes per code (4 KB for 10-bit); on AVR prefer setLookupTableP().
+     */
+    bool setLookupTable(float *table, uint16_t entries);
+
+    /**
+     * setLookupTableP(table, entries)
+     * - Attaches a constant table stored in flash (PROGMEM) for fixed configurations.
+     * - Never rebuilt: generate it once with fillLookupTable() for the final
+     *   configuration and paste it into the sketch.
+     * - Returns false (table not attached) if entries is too small.
+     */
+    bool setLookupTableP(const float *table, uint16_t entries);
+
+    /**
+     * fillLookupTable(table, entries)
+     * - Writes °C for codes 0 .. entries-1 using the current configuration
+     *   (without using any attached table). Use it to generate flash tables.
+     */
+    void fillLookupTable(float *table, uint16_t entries);
+
+    /**
+     * clearLookupTable()
+     * - Detaches any lookup table; conversions use the coefficients again.
+     */
+    void clearLookupTable();
+
     /**
      * readFahrenheit()
-     * - Reads temperature in °C and converts to °F using:
-     *   °F = (°C * 9/5) + 32
+     * - One acquisition converted straight to °F with rawToFahrenheit().
      */
     float readFahrenheit();
 
     /**
      * readKelvin()
-     * - Reads temperature in °C and converts to Kelvin using:
-     *   K = °C + 273.15
+     * - One acquisition converted straight to Kelvin with rawToKelvin().
      */
     float readKelvin();
 
+    /**
+     * rawToFahrenheit(raw)
+     * - °F scale folded into the cached coefficients:
+     *   tempF = (1.8 * a) * raw + (1.8 * b + 32)
+     * - One single-precision multiply-add, no double literals.
+     * - With a lookup table, linearization or correction curve:
+     *   rawToCelsius(raw) * 1.8f + 32.0f.
+     */
+    float rawToFahrenheit(int raw);
+
+    /**
+     * rawToKelvin(raw)
+     * - Same as rawToFahrenheit() with tempK = a * raw + (b + 273.15).
+     */
+    float rawToKelvin(int raw);
+
+    /* ---------- Device Profiles ---------- */
+    /**
+     * setDevice(device, linearize)
+     * - Applies the built-in profile of an AD849x variant in one step:
+     *   offset voltage, sensitivity, amplifier gain and thermocouple type.
+     * - linearize = true enables NIST linearization for the variant's type
+     *   (J or K), false keeps the linear 5mV/°C transfer.
+     * - Cached conversion constants are recomputed once; profiles are read
+     *   from flash, so switching at runtime is cheap.
+     * - Calibration offset is kept. Override single values afterwards with the
+     *   usual setters if your module differs (e.g. another REF voltage).
+     * - Returns false for an unknown device.
+     */
+    bool setDevice(AD849x_Device device, bool linearize = true);
+
+    /**
+     * getDevice()
+     * - Returns the last device selected with setDevice()
+     *   (AD849X_DEVICE_COUNT if none was selected).
+     */
+    AD849x_Device getDevice();
+
+    /**
+     * getDeviceProfile(device, profile)
+     * - Copies a built-in profile out of flash. Returns false for an unknown device.
+     */
+    static bool getDeviceProfile(AD849x_Device device, AD849x_DeviceProfile &profile);
+
+    /* ---------- Correction Curve ---------- */
+    /**
+     * setCorrectionCurve(deltas, points, startC, stepC)
+     * - Per-probe piecewise-linear correction on a UNIFORM grid, applied after
+     *   voltageToCelsius() (and after linearization / calibration offset):
+     *   tempC += curve(tempC)
+     * - deltas: caller-owned int16 corrections in 0.01°C (±327.67°C), one per point.
+     * - Breakpoint i is at startC + i * stepC.
+     * - Evaluation is O(1): index from a precomputed reciprocal, then one lerp.
+     * - Outside the grid the end correction is held.
+     * - 2 bytes per point: a 200-point curve is 400 bytes, so many per-channel
+     *   curves fit in SRAM (or keep them const in flash on ARM/ESP32).
+     */
+    void setCorrectionCurve(const int16_t *deltas, uint16_t points, float startC, float stepC);
+
+    /**
+     * setCorrectionCurve(deltas, breakpoints, points, reciprocals)
+     * - Same for a NON-UNIFORM grid.
+     * - breakpoints: caller-owned int16 temperatures in 0.1°C, strictly ascending.
+     * - Evaluation uses binary search: O(log points).
+     * - reciprocals: optional caller-owned workspace of points - 1 entries,
+     *   filled here with 2^32 / segment width; the integer path
+     *   (rawToMilliCelsius()) then interpolates with one 32-bit multiply.
+     *   Without it, that path needs one 32-bit division per conversion.
+     *
+     * Example:
+     *   static const int16_t dy[4] = {0, 50, 120, 80};        // 0.01°C
+     *   static const int16_t dx[4] = {0, 1000, 2500, 6000};   // 0.1°C
+     *   static uint32_t inv[3];
+     *   thermo.setCorrectionCurve(dy, dx, 4, inv);
+     */
+    void setCorrectionCurve(const int16_t *deltas, const int16_t *breakpoints, uint16_t points, uint32_t *reciprocals = nullptr);
+
+    /**
+     * clearCorrectionCurve()
+     * - Removes the correction curve.
+     */
+    void clearCorrectionCurve();
+
+    /**
+     * curveCorrection(tempC)
+     * - Returns the correction in °C the curve adds at tempC (0 if no curve).
+     */
+    float curveCorrection(float tempC);
+
+    /* ---------- Thermocouple Linearization ---------- */
+    /**
+     * setThermocoupleType(type)
+     * - Enables NIST ITS-90 linearization for K, J, T, E or N thermocouples.
+     * - The amplifier output is converted back to the thermocouple EMF:
+     *   emf_mV = (voltage - offset_voltage) * 1000 / amplifierGain
+     *   and the NIST inverse polynomial (Horner's scheme) gives the true temperature.
+     * - Removes the several-degree error of the linear 5mV/°C assumption at
+     *   high (furnace) and low temperatures.
+     * - Applies to every conversion path (float, fixed-point, lookup table).
+     * - In this mode sensitivity is not used; the amplifier gain defines the scale.
+     * - AD849X_TYPE_LINEAR switches linearization off (default).
+     */
+    void setThermocoupleType(AD849x_ThermocoupleType type);
+
+    /**
+     * getThermocoupleType()
+     * - Returns the selected thermocouple type.
+     */
+    AD849x_ThermocoupleType getThermocoupleType();
+
+    /**
+     * setAmplifierGain(gain)
+     * - AD849x internal gain (thermocouple EMF -> output), used by linearization.
+     * - Typical (verify with datasheet):
+     *   - AD8495 / AD8497 (K): 122.4
+     *   - AD8494 / AD8496 (J): 96.7
+     * - Default: 122.4
+     */
+    void setAmplifierGain(float gain);
+
+    /**
+     * emfToCelsius(type, emf_mV)
+     * - NIST ITS-90 inverse polynomial, float Horner evaluation.
+     * - emf_mV: thermocouple EMF referenced to 0°C, in mV (clamped to the type's range).
+     * - Returns °C; AD849X_TYPE_LINEAR returns NAN.
+     */
+    static float emfToCelsius(AD849x_ThermocoupleType type, float emf_mV);
+
+    /**
+     * emfToMilliCelsius(type, emf_uV)
+     * - Same polynomial evaluated in fixed point (no float operations).
+     * - emf_uV: EMF in µV. Returns m°C.
+     * - Both paths stay within ~10 m°C of the double-precision polynomial
+     *   (well inside the NIST fit error of the inverse functions).
+     */
+    static int32_t emfToMilliCelsius(AD849x_ThermocoupleType type, int32_t emf_uV);
+
+    /* ---------- Fixed-point Temperature ---------- */
+    /**
+     * rawToMilliCelsius(raw)
+     * - Integer-only conversion of an ADC count (readRaw() scale) to m°C.
+     * - Uses precomputed Q-format coefficients derived from reference_voltage,
+     *   resolution, oversampling, offset_voltage, sensitivity, gain and offset:
+     *   mC = (raw * a_q + b_q) >> shift
+     * - No float operations and no division at runtime (fast on FPU-less AVR);
+     *   a non-uniform correction curve needs its reciprocals workspace for
+     *   this (see setCorrectionCurve()).
+     * - Coefficients are recomputed automatically by every setter and calibrate().
+     * - Accuracy vs the float path: see getMilliCelsiusErrorBound().
+     */
+    int32_t rawToMilliCelsius(int raw);
+
+    /**
+     * readMilliCelsius()
+     * - Reads averaged ADC and returns temperature in m°C (integer path).
+     */
+    int32_t readMilliCelsius();
+
+    /**
+     * rawToMilliFahrenheit(raw) / rawToMilliKelvin(raw)
+     * - Integer-only variants of rawToFahrenheit() / rawToKelvin().
+     * - Linear °F uses its own Q-format pair (one multiply-add and shift).
+     * - Kelvin adds 273150 to rawToMilliCelsius().
+     * - Error bound: getMilliCelsiusErrorBound() (x1.8 for °F, +1 for rounding).
+     */
+    int32_t rawToMilliFahrenheit(int raw);
+    int32_t rawToMilliKelvin(int raw);
+
+    /**
+     * getMilliCelsiusErrorBound()
+     * - Worst-case difference in m°C between rawToMilliCelsius() and the exact
+     *   (real-number) result of voltageToCelsius(rawToVoltage(raw)) * 1000:
+     *   bound = 1 + effective_resolution / 2^(shift + 1)
+     * - Typically 1..2 m°C for a 10/12-bit ADC, ~17 m°C with 15-bit oversampling.
+     * - With linearization, polynomial and EMF quantization terms are added.
+     * - A correction curve adds Q16 interpolation rounding (steepest rise / 2^14)
+     *   and scales the input error by its steepest slope.
+     */
+    uint16_t getMilliCelsiusErrorBound();
+
+    /* ---------- Inverse Conversion ---------- */
+    /**
+     * celsiusToVoltage(tempC)
+     * - Inverse of voltageToCelsius(): amplifier output voltage at tempC.
+     * - Linear: closed form V = (tempC - offset) / gain * sensitivity + offset_voltage.
+     * - Linearization / correction curve: bisection over 0 .. Vref (24 steps).
+     */
+    float celsiusToVoltage(float tempC);
+
+    /**
+     * celsiusToRaw(tempC)
+     * - Smallest readRaw() count whose rawToCelsius() is >= tempC, so
+     *   readRaw() >= celsiusToRaw(T)  <=>  temperature >= T
+     *   with the library's own conversion (no rounding mismatch at the edge).
+     * - Linear: closed form then at most a step or two of correction.
+     * - Otherwise: binary search over 0 .. getEffectiveResolution().
+     * - Returns getEffectiveResolution() + 1 when tempC is above full scale.
+     * - Precompute once, then compare integers per sample.
+     * - Recompute after changing configuration (setVref(), setOversampling(), ...).
+     */
+    int32_t celsiusToRaw(float tempC);
+
+    /* ---------- Over-temperature Trip ---------- */
+    /**
+     * setOverTemperatureTrip(tempC, callback, context)
+     * - Converts tempC to ADC counts once; the check is then an integer compare:
+     *   - pushSample() into the ring buffer: native ADC count, inside the ISR;
+     *     trips only after setTripDebounce() consecutive samples at or above
+     *     the limit (default 3), so a single EMI spike cannot latch it.
+     *   - pushSample() with a decimator: each CIC output (already an average
+     *     of ratio samples), inside the ISR; raw samples are not compared.
+     *   - every new averaged readRaw() acquisition (not in decimator mode).
+     * - The trip latches: isTripped() stays true and callback runs once until
+     *   resetTrip().
+     * - The threshold follows configuration changes automatically.
+     */
+    void setOverTemperatureTrip(float tempC, AD849x_TripCallback callback = nullptr, void *context = nullptr);
+
+    /**
+     * setTripDebounce(samples)
+     * - Consecutive pushSample() samples over the limit needed to trip
+     *   (1 .. 255, 0 is treated as 1; default 3).
+     * - Any sample below the limit restarts the count.
+     * - Applies to ring-buffer mode only; CIC outputs and readRaw() averages
+     *   are compared directly.
+     */
+    void setTripDebounce(uint8_t samples);
+
+    /**
+     * clearOverTemperatureTrip()
+     * - Disables the trip check and clears the latch.
+     */
+    void clearOverTemperatureTrip();
+
+    /**
+     * isTripped() / resetTrip()
+     * - Latched trip state; resetTrip() re-arms it.
+     */
+    bool isTripped();
+    void resetTrip();
+
+    /**
+     * getTripRaw()
+     * - Trip threshold in readRaw() counts (0 when disabled).
+     */
+    uint16_t getTripRaw();
+
     /* ---------- Calibration ---------- */
     /**
      * calibrate(actualTempC)
@@ -178,6 +882,17 @@ public:
      */
     float readFilteredTemperatureC(float alpha = 0.1);
 
+    /* ---------- Snapshot ---------- */
+    /**
+     * read(alpha)
+     * - Performs a single averaged acquisition and derives all values from it.
+     * - Replaces calling readRaw(), readVoltage(), readCelsius(), readFahrenheit(),
+     *   readKelvin(), readFilteredTemperatureC() and FaultDetect() one after another
+     *   (which costs one acquisition each).
+     * - alpha: EMA factor for the filtered field (see readFilteredTemperatureC()).
+     */
+    Measurement read(float alpha = 0.1);
+
     /* ---------- Diagnostics ---------- */
     /**
      * FaultDetect()
@@ -193,6 +908,8 @@ private:
     /* ---------- Hardware ---------- */
     uint8_t analog_pin;
 
+    uint16_t sampleADC() { return ad849xReadADC(analog_pin); }
+
     /* ---------- ADC ---------- */
     float reference_voltage;
     uint16_t resolution;
@@ -205,8 +922,1787 @@ private:
     float offset;
     float gain;
 
+    /* ---------- Thermocouple Linearization ---------- */
+    AD849x_ThermocoupleType tc_type = AD849X_TYPE_LINEAR;
+    float amplifier_gain = 122.4;
+    AD849x_Device device_id = AD849X_DEVICE_COUNT;
+
+    /* ---------- Cached Conversion Coefficients ---------- */
+    float coef_a = 0;
+    float coef_b = 0;
+    int32_t fx_a = 0;
+    int32_t fx_b = 0;
+    uint8_t fx_shift = 0;
+
+    float emf_a = 0;        // mV per count
+    float emf_b = 0;        // mV
+    int32_t fe_a = 0;       // Q-format, 1/16 µV per count
+    int32_t fe_b = 0;
+    uint8_t fe_shift = 0;
+    int32_t gain_q16 = 65536;
+    int32_t offset_mc = 0;
+
+    /* ---------- Correction Curve ---------- */
+    const int16_t *curve_y = nullptr;        // 0.01°C
+    const int16_t *curve_x = nullptr;        // 0.1°C, nullptr = uniform grid
+    uint16_t curve_points = 0;
+    float curve_x0 = 0;                      // °C
+    float curve_inv_step = 0;                // 1 / °C
+    int32_t curve_x0_mc = 0;
+    uint32_t curve_span_s = 0;               // (points - 1) * step, scaled m°C
+    uint16_t curve_step_s = 0;               // step in m°C >> curve_step_shift
+    uint16_t curve_recip_m = 0;              // 2^curve_recip_s / curve_step_s
+    uint8_t curve_recip_s = 16;
+    uint8_t curve_step_shift = 0;
+    const uint32_t *curve_recip = nullptr;   // 2^32 / width in m°C per segment
+    uint32_t curve_dy_max_mc = 0;            // steepest segment rise, m°C
+    uint32_t curve_dx_min_mc = 0;            // narrowest segment, m°C
+
+    int32_t curveCorrectionMilli(int32_t tempMilliC);
+    uint16_t curveSegment(float key10);
+    uint16_t curveSegmentMilli(int32_t tempMilliC);
+    void measureCurve();
+    static int32_t mulQ16(int32_t dy, uint16_t frac);
+
+    /* ---------- Unit Coefficients ---------- */
+    float coef_fa = 0;
+    float coef_fb = 0;
+    float coef_kb = 0;
+    int32_t fxf_a = 0;
+    int32_t fxf_b = 0;
+    uint8_t fxf_shift = 0;
+
+    void updateCoefficients();
+    static void quantize(float a, float b, uint16_t maxRaw, int32_t &qa, int32_t &qb, uint8_t &shift);
+    static int32_t emfQ4ToMilliCelsius(AD849x_ThermocoupleType type, int32_t emf_q4);
+
+    /* ---------- Lookup Table ---------- */
+    float *lut_ram = nullptr;
+    const float *lut_flash = nullptr;
+    uint16_t lut_entries = 0;
+
+    float computeCelsius(int raw);
+    bool lutActive(int raw);
+    float lutRead(int raw);
+
     /* ---------- Filtering & Sampling ---------- */
     float filtered_temperature;
-    uint8_t avg_sample = 10;
+    uint16_t avg_sample = 10;
+    uint32_t sample_budget_us = 0;
+    uint8_t os_bits = 0;
+    uint8_t os_request = 0;                  // setOversampling() value before clamping
+    uint16_t effective_resolution;
+
+    /* ---------- Non-blocking Acquisition ---------- */
+    uint32_t acq_sum = 0;
+    uint16_t acq_count = 0;
+    uint32_t acq_start_us = 0;
+    int acq_result = 0;
+    bool acq_busy = false;
+    bool acq_continuous = false;
+    bool acq_ready = false;
+
+    /* ---------- Over-temperature Trip ---------- */
+    bool trip_enabled = false;
+    volatile bool trip_armed = false;        // enabled and reachable within full scale
+    float trip_celsius = 0;
+    uint16_t trip_raw = 0;                   // readRaw() scale
+    uint16_t trip_native = 0xFFFF;           // pushSample() scale
+    uint32_t trip_decimated = 0xFFFFFFFF;    // CIC rawOutput() scale
+    uint8_t trip_samples = 3;                // consecutive samples to trip
+    volatile uint8_t trip_run = 0;           // current run over trip_native
+    volatile bool tripped = false;
+    AD849x_TripCallback trip_callback = nullptr;
+    void *trip_context = nullptr;
+
+    void updateTrip();
+    void trip();
+
+    /* ---------- CIC Decimator ---------- */
+    AD849xCIC_7Semi *decimator = nullptr;
+    static const uint16_t DECIMATOR_NO_SAMPLE = 0xFFFF;
+    volatile uint32_t decimated_out = 0;     // raw comb output (gain ratio^order)
+    volatile bool decimated_fresh = false;
+    volatile bool decimated_ready = false;   // a CIC output has been latched
+    volatile uint16_t decimated_latest = DECIMATOR_NO_SAMPLE;   // last sample before that
+
+    /* ---------- Buffered (ISR) Acquisition ---------- */
+    volatile uint16_t *ring = nullptr;       // caller-owned, see setBuffer()
+    uint8_t ring_mask = 0;                   // size - 1
+    volatile uint8_t ring_head = 0;
+    volatile uint8_t ring_tail = 0;
+    bool buffered = false;
+
+    uint8_t readBufferedSum(uint32_t &sum, uint64_t &sumSq, uint16_t &ref);
+
+    /* ---------- Reading Cache ---------- */
+    uint32_t cache_max_age = 0;
+    uint32_t cache_time = 0;
+    uint32_t cache_hits = 0;
+    uint32_t cache_misses = 0;
+    bool cache_valid = false;
+
+    /* ---------- Acquisition Core ---------- */
+    int last_raw = 0;
+    float last_mean = 0;
+    uint16_t last_count = 0;
+    float last_variance = 0;                 // native counts^2, per sample
+
+    void refresh();
+    void acquire();
+    uint16_t windowLength();
+    bool windowDone(uint16_t count, uint32_t startUs);
+    int averageToRaw(uint32_t sum, uint16_t count);
+    void applyOversampling();
+
+    /* ---------- Helpers ---------- */
+    float updateFilter(float current, float alpha);
+    uint8_t voltageInRange(float voltage);
+};
+
+/* ---------- Fixed-rate Sampling ---------- */
+/**
+ * AD849xScheduler_7Semi
+ * - Samples an AD849x_7Semi at a fixed rate with a micros() deadline scheduler
+ *   and records the inter-sample jitter.
+ * - Separate from the sensor so only sketches that pace their sampling pay
+ *   for the schedule, the last snapshot and the statistics (~70 bytes on AVR).
+ * - The sensor must outlive the scheduler.
+ *
+ * Example:
+ *   AD849xScheduler_7Semi pacer(thermo);
+ *   pacer.setSampleRate(20);
+ *   void loop() { if (pacer.update()) use(pacer.getMeasurement().celsius); }
+ */
+class AD849xScheduler_7Semi
+{
+public:
+    /**
+     * JitterStats
+     * - Deviation of the measured inter-sample interval from the nominal period.
+     */
+    struct JitterStats
+    {
+        uint32_t minUs;     // Smallest |interval - period| in µs
+        uint32_t maxUs;     // Largest |interval - period| in µs
+        float meanUs;       // Mean |interval - period| in µs
+        uint32_t samples;   // Number of measured intervals
+        uint32_t missed;    // Deadlines skipped because a sample ran later than one period
+    };
+
+    explicit AD849xScheduler_7Semi(AD849x_7Semi &sensor) : thermo(sensor) {}
+
+    /**
+     * setSampleRate(hz)
+     * - Enables fixed-rate sampling driven by a micros() deadline scheduler.
+     * - Deadlines advance by exactly one period, so timing errors do not accumulate.
+     * - hz = 0 disables fixed-rate sampling.
+     * - Resets jitter statistics.
+     */
+    void setSampleRate(float hz);
+
+    /**
+     * getSampleRate()
+     * - Returns the configured sample rate in Hz (0 = disabled).
+     */
+    float getSampleRate();
+
+    /**
+     * update(alpha)
+     * - Call as often as possible from loop() instead of delay() pacing.
+     * - When the next deadline is reached, takes one read() snapshot of the
+     *   sensor and records the inter-sample jitter.
+     * - Returns true when a new sample was taken (see getMeasurement()).
+     * - For hardware-timer pacing, trigger the ADC from the timer ISR and feed
+     *   pushSample() in buffered mode instead.
+     */
+    bool update(float alpha = 0.1);
+
+    /**
+     * getMeasurement()
+     * - Returns the last snapshot taken by update().
+     */
+    AD849x_7Semi::Measurement getMeasurement();
+
+    /**
+     * getJitterStats()
+     * - Returns min / max / mean inter-sample jitter measured by update().
+     */
+    JitterStats getJitterStats();
+
+    /**
+     * resetJitterStats()
+     * - Clears jitter statistics; the schedule keeps running.
+     */
+    void resetJitterStats();
+
+private:
+    AD849x_7Semi &thermo;
+    float sample_rate = 0;
+    uint32_t sample_period_us = 0;
+    uint32_t next_deadline_us = 0;
+    uint32_t last_sample_us = 0;
+    bool paced_started = false;
+    bool have_last_sample = false;
+    AD849x_7Semi::Measurement paced_measurement = {};
+    JitterStats jitter = {};
+    uint32_t jitter_sum_us = 0;
+};
+
+/* ---------- AD849x Multi-channel Scanner ---------- */
+/**
+ * AD849xArray_7Semi<CHANNELS>
+ * - Scans CHANNELS AD849x outputs from one object.
+ * - Structure-of-arrays layout: pins, coefficients, sums and filter states are
+ *   kept in contiguous per-field arrays instead of one object per sensor.
+ * - step() does ONE analogRead() on the current channel and moves to the next
+ *   (round-robin); after avg_sample passes over all channels every channel is
+ *   converted in one batch loop.
+ * - Scan time = CHANNELS * avg_sample conversions, linear in channel count.
+ *
+ * Example:
+ *   const uint8_t pins[4] = {A0, A1, A2, A3};
+ *   AD849xArray_7Semi<4> rack;
+ *   rack.begin(pins, 5.0, 1023);
+ *   rack.scan();
+ *   float t2 = rack.getCelsius(2);
+ */
+template <uint8_t CHANNELS>
+class AD849xArray_7Semi
+{
+public:
+    /* ---------- Initialization ---------- */
+    /**
+     * begin(pins, vRef, adcResolution)
+     * - pins: array of CHANNELS analog pins (copied).
+     * - vRef / adcResolution: shared by all channels (one ADC).
+     * - Every channel starts with offset_voltage = 1.25 V, sensitivity = 0.005 V/°C,
+     *   gain = 1.0, offset = 0.0, linear transfer (AD849X_TYPE_LINEAR,
+     *   amplifier gain 122.4) and an uninitialized filter.
+     */
+    void begin(const uint8_t *pins, float vRef, uint16_t adcResolution);
+
+    /* ---------- Configuration ---------- */
+    void setVref(float vRef);
+    void setADCResolution(uint16_t adcResolution);
+    void setOffsetVoltage(uint8_t channel, float offset);
+    void setSensitivity(uint8_t channel, float voltsPerDegC);
+
+    /**
+     * setSampling(samples)
+     * - Samples averaged per channel and scan (1..65535). Restarts the current scan.
+     */
+    void setSampling(uint16_t samples);
+    uint16_t getSampling();
+
+    /**
+     * setFilterAlpha(alpha)
+     * - EMA factor applied to every channel on each completed scan (1.0 = off).
+     */
+    void setFilterAlpha(float alpha);
+
+    /**
+     * setThermocoupleType(type) / setAmplifierGain(gain)
+     * - NIST linearization for all channels (see AD849x_7Semi::setThermocoupleType()).
+     */
+    void setThermocoupleType(AD849x_ThermocoupleType type);
+    void setAmplifierGain(float gain);
+
+    /**
+     * setThermocoupleType(channel, type) / setAmplifierGain(channel, gain)
+     * - Same for one channel, for racks mixing J and K amplifiers.
+     */
+    void setThermocoupleType(uint8_t channel, AD849x_ThermocoupleType type);
+    void setAmplifierGain(uint8_t channel, float gain);
+
+    /**
+     * setDevice(channel, device, linearize)
+     * - Applies an AD849x variant profile to one channel
+     *   (see AD849x_7Semi::setDevice()); calibration offset is kept.
+     * - Returns false for an unknown channel or device.
+     *
+     * Example (AD8494 on channel 0, AD8495 on channel 1):
+     *   rack.setDevice(0, AD8494_J);
+     *   rack.setDevice(1, AD8495_K);
+     */
+    bool setDevice(uint8_t channel, AD849x_Device device, bool linearize = true);
+
+    /**
+     * calibrate(channel, actualTempC)
+     * - One-point calibration of one channel against its last scanned value.
+     * - The scanned value already includes the current offset, so the
+     *   correction is added: repeated calls refine instead of undoing each other.
+     */
+    void calibrate(uint8_t channel, float actualTempC);
+
+    /* ---------- Scanning ---------- */
+    /**
+     * step()
+     * - One analogRead() on the current channel, then advances round-robin.
+     * - Returns true when a full scan completed and all channels were converted.
+     */
+    bool step();
+
+    /**
+     * scan()
+     * - Blocking full scan (calls step() until it completes).
+     */
+    void scan();
+
+    /* ---------- Results (last completed scan) ---------- */
+    uint8_t channels() { return CHANNELS; }
+    int getRaw(uint8_t channel);
+    float getCelsius(uint8_t channel);
+    float getFiltered(uint8_t channel);
+
+private:
+    /* ---------- Shared ADC ---------- */
+    float reference_voltage;
+    uint16_t resolution;
+    uint16_t avg_sample = 10;
+    float filter_alpha = 1.0;
+
+    /* ---------- Per-channel (structure of arrays) ---------- */
+    uint8_t pin[CHANNELS];
+    AD849x_ThermocoupleType tc_type[CHANNELS];
+    float amplifier_gain[CHANNELS];
+    float offset_voltage[CHANNELS];
+    float sensitivity[CHANNELS];
+    float gain[CHANNELS];
+    float offset[CHANNELS];
+    float coef_a[CHANNELS];
+    float coef_b[CHANNELS];
+    uint32_t sum[CHANNELS];
+    int raw[CHANNELS];
+    float celsius[CHANNELS];
+    float filtered[CHANNELS];
+
+    /* ---------- Scan State ---------- */
+    uint8_t current = 0;
+    uint16_t pass = 0;
+
+    void updateCoefficients(uint8_t channel);
+    void convertAll();
+};
+
+/* ---------- AD849xArray_7Semi Implementation ---------- */
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::begin(const uint8_t *pins, float vRef, uint16_t adcResolution)
+{
+    reference_voltage = vRef;
+    resolution = adcResolution;
+
+    for (uint8_t ch = 0; ch < CHANNELS; ch++)
+    {
+        pin[ch] = pins[ch];
+        offset_voltage[ch] = 1.25;
+        sensitivity[ch] = 0.005;
+        gain[ch] = 1.0;
+        offset[ch] = 0.0;
+        tc_type[ch] = AD849X_TYPE_LINEAR;
+        amplifier_gain[ch] = 122.4;
+        sum[ch] = 0;
+        raw[ch] = 0;
+        celsius[ch] = NAN;
+        filtered[ch] = NAN;
+        updateCoefficients(ch);
+        pinMode(pin[ch], INPUT);
+    }
+
+    current = 0;
+    pass = 0;
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::setVref(float vRef)
+{
+    reference_voltage = vRef;
+    for (uint8_t ch = 0; ch < CHANNELS; ch++) updateCoefficients(ch);
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::setADCResolution(uint16_t adcResolution)
+{
+    resolution = adcResolution;
+    for (uint8_t ch = 0; ch < CHANNELS; ch++) updateCoefficients(ch);
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::setOffsetVoltage(uint8_t channel, float offset)
+{
+    if (channel >= CHANNELS) return;
+    offset_voltage[channel] = offset;
+    updateCoefficients(channel);
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::setSensitivity(uint8_t channel, float voltsPerDegC)
+{
+    if (channel >= CHANNELS) return;
+    sensitivity[channel] = voltsPerDegC;
+    updateCoefficients(channel);
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::setSampling(uint16_t samples)
+{
+    if (samples == 0) samples = 1;
+    avg_sample = samples;
+
+    for (uint8_t ch = 0; ch < CHANNELS; ch++) sum[ch] = 0;
+    current = 0;
+    pass = 0;
+}
+
+template <uint8_t CHANNELS>
+uint16_t AD849xArray_7Semi<CHANNELS>::getSampling()
+{
+    return avg_sample;
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::setFilterAlpha(float alpha)
+{
+    filter_alpha = alpha;
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::setThermocoupleType(AD849x_ThermocoupleType type)
+{
+    for (uint8_t ch = 0; ch < CHANNELS; ch++) setThermocoupleType(ch, type);
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::setAmplifierGain(float gain)
+{
+    for (uint8_t ch = 0; ch < CHANNELS; ch++) setAmplifierGain(ch, gain);
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::setThermocoupleType(uint8_t channel, AD849x_ThermocoupleType type)
+{
+    if (channel >= CHANNELS) return;
+    tc_type[channel] = type;
+    updateCoefficients(channel);
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::setAmplifierGain(uint8_t channel, float gain)
+{
+    if (channel >= CHANNELS || gain <= 0) return;
+    amplifier_gain[channel] = gain;
+    updateCoefficients(channel);
+}
+
+template <uint8_t CHANNELS>
+bool AD849xArray_7Semi<CHANNELS>::setDevice(uint8_t channel, AD849x_Device device, bool linearize)
+{
+    AD849x_DeviceProfile profile;
+    if (channel >= CHANNELS || !AD849x_7Semi::getDeviceProfile(device, profile)) return false;
+
+    offset_voltage[channel] = profile.offset_voltage;
+    sensitivity[channel] = profile.sensitivity;
+    amplifier_gain[channel] = profile.amplifier_gain;
+    tc_type[channel] = linearize ? (AD849x_ThermocoupleType)profile.thermocouple : AD849X_TYPE_LINEAR;
+
+    updateCoefficients(channel);
+    return true;
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::calibrate(uint8_t channel, float actualTempC)
+{
+    /**
+     * - offset += actual - measured (measured already contains offset).
+     * - celsius[] is moved to the calibrated value so a second call before
+     *   the next scan sees the corrected reading.
+     */
+    if (channel >= CHANNELS || isnan(celsius[channel])) return;
+    float correction = actualTempC - celsius[channel];
+    offset[channel] += correction;
+    celsius[channel] += correction;
+    updateCoefficients(channel);
+}
+
+template <uint8_t CHANNELS>
+bool AD849xArray_7Semi<CHANNELS>::step()
+{
+    /**
+     * - Round-robin: ch0, ch1, ... chN-1, ch0, ... (one conversion per call).
+     */
+    uint8_t p = pin[current];
+    sum[current] += ad849xReadADC(p);
+
+    if (++current < CHANNELS) return false;
+
+    current = 0;
+    if (++pass < avg_sample) return false;
+
+    pass = 0;
+    convertAll();
+    return true;
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::scan()
+{
+    while (!step())
+    {
+    }
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::convertAll()
+{
+    /**
+     * - Batch pass over contiguous arrays:
+     *   raw = sum / avg_sample
+     *   tempC = coef_a * raw + coef_b
+     *   (linearized channels: the same line gives emf, then
+     *   tempC = NIST(emf) * gain + offset with that channel's type)
+     *   filtered = EMA(tempC)
+     */
+    for (uint8_t ch = 0; ch < CHANNELS; ch++)
+    {
+        raw[ch] = sum[ch] / avg_sample;
+        sum[ch] = 0;
+        celsius[ch] = coef_a[ch] * raw[ch] + coef_b[ch];
+    }
+
+    for (uint8_t ch = 0; ch < CHANNELS; ch++)
+    {
+        if (tc_type[ch] == AD849X_TYPE_LINEAR) continue;
+        celsius[ch] = AD849x_7Semi::emfToCelsius(tc_type[ch], celsius[ch]) * gain[ch] + offset[ch];
+    }
+
+    for (uint8_t ch = 0; ch < CHANNELS; ch++)
+    {
+        if (isnan(filtered[ch])) filtered[ch] = celsius[ch];
+        filtered[ch] = filter_alpha * celsius[ch] + (1.0f - filter_alpha) * filtered[ch];
+    }
+}
+
+template <uint8_t CHANNELS>
+void AD849xArray_7Semi<CHANNELS>::updateCoefficients(uint8_t channel)
+{
+    /**
+     * - Folds rawToVoltage() and voltageToCelsius() into tempC = a * raw + b:
+     *   a = (Vref / resolution) * gain / sensitivity
+     *   b = offset - offset_voltage * gain / sensitivity
+     * - Linearized: the same arrays hold raw -> EMF (mV) coefficients:
+     *   a = (Vref / resolution) * 1000 / amplifier_gain
+     *   b = -offset_voltage * 1000 / amplifier_gain
+     */
+    if (tc_type[channel] != AD849X_TYPE_LINEAR)
+    {
+        float m = 1000.0f / amplifier_gain[channel];
+        coef_a[channel] = (reference_voltage / resolution) * m;
+        coef_b[channel] = -offset_voltage[channel] * m;
+        return;
+    }
+
+    float k = gain[channel] / sensitivity[channel];
+    coef_a[channel] = (reference_voltage / resolution) * k;
+    coef_b[channel] = offset[channel] - offset_voltage[channel] * k;
+}
+
+template <uint8_t CHANNELS>
+int AD849xArray_7Semi<CHANNELS>::getRaw(uint8_t channel)
+{
+    return (channel < CHANNELS) ? raw[channel] : 0;
+}
+
+template <uint8_t CHANNELS>
+float AD849xArray_7Semi<CHANNELS>::getCelsius(uint8_t channel)
+{
+    return (channel < CHANNELS) ? celsius[channel] : NAN;
+}
+
+template <uint8_t CHANNELS>
+float AD849xArray_7Semi<CHANNELS>::getFiltered(uint8_t channel)
+{
+    return (channel < CHANNELS) ? filtered[channel] : NAN;
+}
+
+/* ---------- Compile-time Configured Sensor ---------- */
+/**
+ * AD849xStatic_7Semi<PIN, VREF_MV, ADC_MAX, OFFSET_MV, SENS_UV>
+ * - Subset of the AD849x_7Semi reading API for builds with a hard-coded,
+ *   linear 5mV/°C-style configuration.
+ * - Pin, Vref, ADC max count, offset voltage and sensitivity are template
+ *   arguments, so every conversion constant is constexpr and folds into
+ *   immediates (no runtime divisions, no per-object coefficient storage).
+ * - Only the calibration offset, averaging count and filter state live in RAM.
+ *
+ * Supported (same behavior as AD849x_7Semi):
+ * - begin(), setSampling() / getSampling(), readRaw(), rawToVoltage(),
+ *   readVoltage(), voltageToCelsius(), rawToCelsius(), readCelsius(),
+ *   readFahrenheit(), readKelvin(), rawToMilliCelsius(), readMilliCelsius(),
+ *   calibrate(), readFilteredTemperatureC(), read(), FaultDetect().
+ *
+ * Not supported (use AD849x_7Semi):
+ * - Runtime setters for the template values (setVref(), setADCResolution(),
+ *   setOffsetVoltage(), setSensitivity()) and the gain factor.
+ * - Thermocouple linearization, setDevice(), amplifier gain, correction
+ *   curves and lookup tables.
+ * - Oversampling, sampling time budget, reading cache and sample variance.
+ * - Non-blocking startConversion() / poll(), buffered ISR acquisition and
+ *   the CIC decimator.
+ * - celsiusToRaw() / celsiusToVoltage(), over-temperature trip, batch
+ *   conversion and the m°F / mK integer variants.
+ *
+ * Cost:
+ * - Flash and cycle savings depend on the board and compiler and are not
+ *   measured by the library; the StaticConfig example builds the same
+ *   sketch with either class (USE_STATIC) for a flash comparison, and the
+ *   Benchmark example times both conversion paths.
+ *
+ * Template parameters:
+ * - PIN:       analog pin connected to AD849x output
+ * - VREF_MV:   ADC reference voltage in mV (e.g. 5000, 3300)
+ * - ADC_MAX:   ADC maximum count (1023 for 10-bit, 4095 for 12-bit)
+ * - OFFSET_MV: amplifier output at 0°C in mV (e.g. 1250)
+ * - SENS_UV:   sensitivity in µV/°C (e.g. 5000 for 5mV/°C)
+ *
+ * Example:
+ *   AD849xStatic_7Semi<A0, 5000, 1023, 1250, 5000> thermo;
+ *   thermo.begin();
+ *   float tC = thermo.readCelsius();
+ */
+template <uint8_t PIN, uint16_t VREF_MV, uint16_t ADC_MAX, uint16_t OFFSET_MV, uint16_t SENS_UV>
+class AD849xStatic_7Semi
+{
+public:
+    typedef AD849x_7Semi::Measurement Measurement;
+
+    /* ---------- Compile-time Constants ---------- */
+    static constexpr float VREF = VREF_MV / 1000.0f;
+    static constexpr float VOLTS_PER_COUNT = VREF_MV / (1000.0f * ADC_MAX);
+    static constexpr float DEG_PER_VOLT = 1000000.0f / SENS_UV;
+    static constexpr float COEF_A = VOLTS_PER_COUNT * DEG_PER_VOLT;
+    static constexpr float COEF_B = -(OFFSET_MV / 1000.0f) * DEG_PER_VOLT;
+
+    /* ---------- Initialization ---------- */
+    /**
+     * begin()
+     * - Configures PIN as INPUT and resets offset, averaging (10) and filter.
+     */
+    void begin()
+    {
+        offset = 0;
+        offset_mc = 0;
+        avg_sample = 10;
+        filtered_temperature = NAN;
+        pinMode(PIN, INPUT);
+    }
+
+    /* ---------- Configuration ---------- */
+    void setSampling(uint16_t samples) { avg_sample = samples ? samples : 1; }
+    uint16_t getSampling() { return avg_sample; }
+
+    /* ---------- Reading ---------- */
+    int readRaw()
+    {
+        uint32_t value = 0;
+
+        for (uint16_t i = 0; i < avg_sample; i++)
+        {
+            value += ad849xReadADC(PIN);
+        }
+
+        return value / avg_sample;
+    }
+
+    float rawToVoltage(int raw) { return raw * VOLTS_PER_COUNT; }
+    float readVoltage() { return rawToVoltage(readRaw()); }
+
+    /* ---------- Temperature ---------- */
+    float voltageToCelsius(float voltage) { return (voltage - OFFSET_MV / 1000.0f) * DEG_PER_VOLT + offset; }
+    float rawToCelsius(int raw) { return COEF_A * raw + COEF_B + offset; }
+    float readCelsius() { return rawToCelsius(readRaw()); }
+    float readFahrenheit() { return readCelsius() * 1.8f + 32.0f; }
+    float readKelvin() { return readCelsius() + 273.15f; }
+
+    /**
+     * rawToMilliCelsius(raw)
+     * - Integer path with compile-time Q-format coefficients (see AD849x_7Semi).
+     */
+    int32_t rawToMilliCelsius(int raw) { return (((int32_t)raw * FX_A + FX_B) >> FX_SHIFT) + offset_mc; }
+    int32_t readMilliCelsius() { return rawToMilliCelsius(readRaw()); }
+
+    /* ---------- Calibration ---------- */
+    /**
+     * calibrate(actualTempC)
+     * - One-point calibration; readCelsius() already includes the current
+     *   offset, so the correction is added (repeated calls refine).
+     */
+    void calibrate(float actualTempC)
+    {
+        offset += actualTempC - readCelsius();
+        offset_mc = lroundf(offset * 1000.0f);
+    }
+
+    /* ---------- Filtering ---------- */
+    float readFilteredTemperatureC(float alpha = 0.1f) { return updateFilter(readCelsius(), alpha); }
+
+    /* ---------- Snapshot ---------- */
+    Measurement read(float alpha = 0.1f)
+    {
+        Measurement m;
+
+        m.raw = readRaw();
+        m.voltage = rawToVoltage(m.raw);
+        m.celsius = rawToCelsius(m.raw);
+        m.fahrenheit = m.celsius * 1.8f + 32.0f;
+        m.kelvin = m.celsius + 273.15f;
+        m.filtered = updateFilter(m.celsius, alpha);
+        m.status = voltageInRange(m.voltage);
+
+        return m;
+    }
+
+    /* ---------- Diagnostics ---------- */
+    uint8_t FaultDetect() { return voltageInRange(readVoltage()); }
+
+private:
+    /* ---------- Compile-time Fixed-point Coefficients ---------- */
+    static constexpr uint8_t fxShift(float span, uint8_t shift)
+    {
+        return (shift == 0 || span * (float)(1UL << shift) < 2147483647.0f) ? shift : fxShift(span, shift - 1);
+    }
+
+    static constexpr float FX_SPAN = 1000.0f * COEF_A * ADC_MAX + 1000.0f * (COEF_B < 0 ? -COEF_B : COEF_B) + 1.0f;
+    static constexpr uint8_t FX_SHIFT = fxShift(FX_SPAN, 24);
+    static constexpr float FX_SCALE = (float)(1UL << FX_SHIFT);
+    static constexpr int32_t FX_A = (int32_t)(1000.0f * COEF_A * FX_SCALE + 0.5f);
+    static constexpr int32_t FX_B = (int32_t)(1000.0f * COEF_B * FX_SCALE + (COEF_B < 0 ? -0.5f : 0.5f))
+                                    + (FX_SHIFT ? (1L << (FX_SHIFT - 1)) : 0);
+
+    /* ---------- Runtime State ---------- */
+    float offset = 0;
+    int32_t offset_mc = 0;
+    uint16_t avg_sample = 10;
+    float filtered_temperature = NAN;
+
+    float updateFilter(float current, float alpha)
+    {
+        if (isnan(filtered_temperature)) filtered_temperature = current;
+        filtered_temperature = alpha * current + (1.0f - alpha) * filtered_temperature;
+        return filtered_temperature;
+    }
+
+    uint8_t voltageInRange(float voltage) { return (voltage > 0.1f && voltage < (VREF - 0.1f)); }
+};
+
+/* ---------- Moving Average Filter ---------- */
+/**
+ * AD849xMovingAverage_7Semi<CAPACITY>
+ * - Sliding-window mean with a running sum and a persistent ring buffer.
+ * - update(x) does one add, one subtract and one store: O(1) per reading,
+ *   independent of the window length.
+ * - Fed by anything that produces readings (readCelsius(), readRaw(),
+ *   getConversion(), AD849xScheduler_7Semi::update(), ...), so a long
+ *   smoothing horizon costs one conversion per update instead of a long
+ *   blocking readRaw() average.
+ * - Float rounding of the running sum is bounded by re-summing the window
+ *   once every window-length updates (amortized O(1)).
+ * - RAM: 4 * CAPACITY bytes + 16 (e.g. 256 points = 1 KB).
+ *
+ * Example:
+ *   AD849xMovingAverage_7Semi<64> avg;
+ *   thermo.setSampling(1);
+ *   float smoothC = avg.update(thermo.readCelsius());
+ */
+template <uint16_t CAPACITY>
+class AD849xMovingAverage_7Semi
+{
+    static_assert(CAPACITY > 0, "AD849xMovingAverage_7Semi: CAPACITY must be > 0");
+
+public:
+    /**
+     * setWindow(points)
+     * - Active window length, 1 .. CAPACITY (clamped); clears the history.
+     */
+    void setWindow(uint16_t points)
+    {
+        window = points < 1 ? 1 : (points > CAPACITY ? CAPACITY : points);
+        reset();
+    }
+
+    uint16_t getWindow() { return window; }
+
+    /**
+     * update(x)
+     * - Adds x, drops the oldest value once the window is full.
+     * - Returns the mean of the values in the window.
+     * - Until the window fills, the mean covers the values seen so far.
+     */
+    float update(float x)
+    {
+        if (filled < window)
+        {
+            sum += x;
+            filled++;
+        }
+        else
+        {
+            sum += x - history[head];
+        }
+
+        history[head] = x;
+        if (++head >= window) head = 0;
+
+        if (--resum_in == 0) resum();
+
+        return value();
+    }
+
+    /**
+     * value()
+     * - Current mean (NAN before the first update()).
+     */
+    float value()
+    {
+        if (filled == 0) return NAN;
+        return (filled == window) ? sum * inv_window : sum / filled;
+    }
+
+    uint16_t count() { return filled; }
+    bool full() { return filled == window; }
+
+    /**
+     * reset()
+     * - Clears the history; the window length is kept.
+     */
+    void reset()
+    {
+        head = 0;
+        filled = 0;
+        sum = 0;
+        inv_window = 1.0f / window;
+        resum_in = window;
+    }
+
+private:
+    float history[CAPACITY];
+    float sum = 0;
+    float inv_window = 1.0f / CAPACITY;
+    uint16_t window = CAPACITY;
+    uint16_t head = 0;
+    uint16_t filled = 0;
+    uint16_t resum_in = CAPACITY;
+
+    void resum()
+    {
+        /**
+         * - Exact sum of the stored values; clears accumulated rounding.
+         */
+        float s = 0;
+        for (uint16_t i = 0; i < filled; i++)
+        {
+            s += history[i];
+        }
+
+        sum = s;
+        resum_in = window;
+    }
+};
+
+/* ---------- Median Filter ---------- */
+/**
+ * AD849xMedianFilter_7Semi<WINDOW>
+ * - Streaming median over the last WINDOW values (odd, 3 .. 31).
+ * - Keeps the window both in arrival order (ring) and sorted:
+ *   each update() binary-searches the outgoing and incoming positions and
+ *   shifts only the elements between them (no re-sort per sample).
+ * - A single spike moves the median by at most one rank, so it never
+ *   reaches the output (unlike a mean or EMA).
+ * - RAM: 8 * WINDOW bytes + 4; cheap enough for one filter per channel.
+ *
+ * Example:
+ *   AD849xMedianFilter_7Semi<5> median;
+ *   float cleanC = median.update(thermo.readCelsius());
+ */
+template <uint8_t WINDOW>
+class AD849xMedianFilter_7Semi
+{
+    static_assert(WINDOW >= 3 && WINDOW <= 31 && (WINDOW & 1), "AD849xMedianFilter_7Semi: WINDOW must be odd, 3 .. 31");
+
+public:
+    /**
+     * update(x)
+     * - Replaces the oldest value with x and returns the new median.
+     * - Until the window fills, returns the median of the values seen so far.
+     */
+    float update(float x)
+    {
+        if (filled < WINDOW)
+        {
+            insertAt(x, filled, lowerBound(x, filled));
+            ring[filled++] = x;
+        }
+        else
+        {
+            float old = ring[head];
+            ring[head] = x;
+            if (++head >= WINDOW) head = 0;
+
+            replace(old, x);
+        }
+
+        return value();
+    }
+
+    /**
+     * value()
+     * - Current median (NAN before the first update()).
+     */
+    float value()
+    {
+        if (filled == 0) return NAN;
+        if (filled & 1) return sorted[filled >> 1];
+        return 0.5f * (sorted[(filled >> 1) - 1] + sorted[filled >> 1]);
+    }
+
+    /**
+     * count() / at(i)
+     * - Values in the window and the i-th smallest of them.
+     */
+    uint8_t count() { return filled; }
+    float at(uint8_t i) { return sorted[i]; }
+
+    void reset()
+    {
+        filled = 0;
+        head = 0;
+    }
+
+private:
+    float ring[WINDOW];
+    float sorted[WINDOW];
+    uint8_t filled = 0;
+    uint8_t head = 0;
+
+    uint8_t lowerBound(float x, uint8_t n)
+    {
+        /**
+         * - First index in sorted[0 .. n) with sorted[i] >= x.
+         */
+        uint8_t lo = 0;
+        while (lo < n)
+        {
+            uint8_t mid = (lo + n) >> 1;
+            if (sorted[mid] < x) lo = mid + 1;
+            else n = mid;
+        }
+        return lo;
+    }
+
+    void insertAt(float x, uint8_t n, uint8_t pos)
+    {
+        for (uint8_t i = n; i > pos; i--)
+        {
+            sorted[i] = sorted[i - 1];
+        }
+        sorted[pos] = x;
+    }
+
+    void replace(float old, float x)
+    {
+        /**
+         * - Removes old and inserts x in one pass: only sorted entries
+         *   between the two positions move by one slot.
+         */
+        uint8_t from = lowerBound(old, WINDOW);
+        uint8_t to = lowerBound(x, WINDOW);
+
+        if (to > from)
+        {
+            to--;
+            for (uint8_t i = from; i < to; i++)
+            {
+                sorted[i] = sorted[i + 1];
+            }
+        }
+        else
+        {
+            for (uint8_t i = from; i > to; i--)
+            {
+                sorted[i] = sorted[i - 1];
+            }
+        }
+
+        sorted[to] = x;
+    }
+};
+
+/* ---------- Hampel Filter ---------- */
+/**
+ * AD849xHampelFilter_7Semi<WINDOW>
+ * - Outlier rejection on top of AD849xMedianFilter_7Semi<WINDOW>.
+ * - For each new value x (causal, no delay):
+ *   - med = median of the window, MAD = median(|window - med|)
+ *   - x is an outlier when |x - med| > threshold * 1.4826 * MAD
+ *     (1.4826 * MAD estimates sigma for Gaussian noise)
+ *   - outliers are replaced by med, other values pass through unchanged
+ * - MAD comes from the sorted window with a two-pointer walk outwards from
+ *   the median: O(WINDOW / 2), no second sort.
+ * - Unlike a plain median, clean samples are not delayed or flattened.
+ *
+ * Example:
+ *   AD849xHampelFilter_7Semi<7> hampel;
+ *   hampel.setThreshold(3.0f, 0.5f);
+ *   float cleanC = hampel.update(thermo.readCelsius());
+ */
+template <uint8_t WINDOW>
+class AD849xHampelFilter_7Semi
+{
+public:
+    /**
+     * setThreshold(sigmas, minDeviation)
+     * - sigmas: rejection threshold in estimated standard deviations (default 3).
+     * - minDeviation: |x - med| must also exceed this (same unit as x); keeps
+     *   ADC quantization steps from being flagged when the window is flat (MAD = 0).
+     */
+    void setThreshold(float sigmas, float minDeviation = 0)
+    {
+        k_mad = sigmas * 1.4826f;
+        min_deviation = minDeviation;
+    }
+
+    /**
+     * update(x)
+     * - Returns x, or the window median when x is flagged as an outlier.
+     * - The raw x always enters the window, so a real step change is accepted
+     *   once it makes up half the window.
+     */
+    float update(float x)
+    {
+        outlier = false;
+
+        if (window.count() >= 3)
+        {
+            float med = window.value();
+            float dev = fabsf(x - med);
+
+            if (dev > min_deviation && dev > k_mad * mad(med))
+            {
+                outlier = true;
+                outliers++;
+                window.update(x);
+                return med;
+            }
+        }
+
+        window.update(x);
+        return x;
+    }
+
+    /**
+     * isOutlier() / getOutlierCount()
+     * - Whether the last update() replaced its input, and how many times so far.
+     */
+    bool isOutlier() { return outlier; }
+    uint32_t getOutlierCount() { return outliers; }
+
+    /**
+     * median()
+     * - Median of the current window.
+     */
+    float median() { return window.value(); }
+
+    void reset()
+    {
+        window.reset();
+        outlier = false;
+        outliers = 0;
+    }
+
+private:
+    AD849xMedianFilter_7Semi<WINDOW> window;
+    float k_mad = 3.0f * 1.4826f;
+    float min_deviation = 0;
+    uint32_t outliers = 0;
+    bool outlier = false;
+
+    float mad(float med)
+    {
+        /**
+         * - Deviations left of the median grow as i walks down, right of it as
+         *   j walks up: merging the two sorted runs gives them in order.
+         * - The (n/2)-th deviation in merged order is the MAD.
+         */
+        uint8_t n = window.count();
+        int8_t i = (n >> 1) - 1;
+        uint8_t j = n >> 1;
+        float dev = 0;
+
+        for (uint8_t k = 0; k <= (n >> 1); k++)
+        {
+            float left = (i >= 0) ? med - window.at(i) : INFINITY;
+            float right = (j < n) ? window.at(j) - med : INFINITY;
+
+            if (left < right)
+            {
+                dev = left;
+                i--;
+            }
+            else
+            {
+                dev = right;
+                j++;
+            }
+        }
+
+        return dev;
+    }
+};
+
+/* ---------- Kalman Filter ---------- */
+/**
+ * AD849xKalman_7Semi
+ * - 1-D Kalman filter for temperature, optionally with a rate (°C/s) state.
+ * - Temperature only (random walk):
+ *   predict: P += q * dt
+ *   update:  K = P / (P + R), T += K * (z - T), P *= 1 - K
+ * - With rate tracking (constant-rate model, white acceleration noise q):
+ *   T follows ramps without the steady lag of an EMA, since the filter
+ *   extrapolates with the estimated rate between readings.
+ * - Measurement noise R:
+ *   - fixed with setMeasurementNoise(), or
+ *   - estimated online: pass getMeasurementVarianceC() to update() each
+ *     reading; it is smoothed (1/16 per update) before use.
+ * - Cost: ~10 flops per update (temperature only), ~25 with rate tracking.
+ *
+ * Example:
+ *   AD849xKalman_7Semi kf;
+ *   kf.setProcessNoise(0.01f);
+ *   kf.setRateTracking(true);
+ *   float tC = thermo.readCelsius();
+ *   float smoothC = kf.update(tC, 0.1f, thermo.getMeasurementVarianceC());
+ */
+class AD849xKalman_7Semi
+{
+public:
+    /**
+     * setProcessNoise(q)
+     * - Temperature only: expected temperature variance growth in °C^2 per second.
+     * - Rate tracking: rate variance growth in (°C/s)^2 per second.
+     * - Larger q follows changes faster; smaller q smooths harder.
+     */
+    void setProcessNoise(float q) { process_noise = q; }
+
+    /**
+     * setMeasurementNoise(r)
+     * - Measurement variance in °C^2; also the starting point of the online estimate.
+     */
+    void setMeasurementNoise(float r) { measurement_noise = r; }
+
+    /**
+     * setRateTracking(enable)
+     * - Adds the rate state; resets the filter.
+     */
+    void setRateTracking(bool enable)
+    {
+        track_rate = enable;
+        reset();
+    }
+
+    /**
+     * update(z, dt, variance)
+     * - z: new temperature reading (°C).
+     * - dt: seconds since the previous update (default 1).
+     * - variance: optional measurement variance of z (°C^2), e.g.
+     *   getMeasurementVarianceC(); NAN keeps the current estimate.
+     * - Returns the filtered temperature.
+     */
+    float update(float z, float dt = 1.0f, float variance = NAN)
+    {
+        if (!isnan(variance))
+        {
+            if (!initialized) measurement_noise = variance;
+            else measurement_noise += (variance - measurement_noise) * 0.0625f;
+        }
+
+        float r = measurement_noise;
+
+        if (!initialized)
+        {
+            temperature = z;
+            rate = 0;
+            p00 = r;
+            p01 = 0;
+            p11 = track_rate ? process_noise : 0;
+            initialized = true;
+            return temperature;
+        }
+
+        if (!track_rate)
+        {
+            p00 += process_noise * dt;
+
+            float k = p00 / (p00 + r);
+            temperature += k * (z - temperature);
+            p00 *= 1.0f - k;
+
+            return temperature;
+        }
+
+        /** Predict: x = F x, P = F P F' + Q */
+        float qdt = process_noise * dt;
+        temperature += rate * dt;
+        p00 += dt * (2.0f * p01 + dt * p11) + qdt * dt * dt * (1.0f / 3.0f);
+        p01 += dt * p11 + qdt * dt * 0.5f;
+        p11 += qdt;
+
+        /** Update */
+        float s = 1.0f / (p00 + r);
+        float k0 = p00 * s;
+        float k1 = p01 * s;
+        float y = z - temperature;
+
+        temperature += k0 * y;
+        rate += k1 * y;
+
+        p11 -= k1 * p01;
+        p01 -= k0 * p01;
+        p00 -= k0 * p00;
+
+        return temperature;
+    }
+
+    /**
+     * getTemperature() / getRate()
+     * - Current estimates (rate is 0 without rate tracking).
+     */
+    float getTemperature() { return temperature; }
+    float getRate() { return rate; }
+
+    /**
+     * getVariance() / getMeasurementNoise()
+     * - Estimate variance P (°C^2) and the R currently in use.
+     */
+    float getVariance() { return p00; }
+    float getMeasurementNoise() { return measurement_noise; }
+
+    /**
+     * reset()
+     * - Next update() re-initializes from its reading; noise settings are kept.
+     */
+    void reset()
+    {
+        initialized = false;
+        temperature = NAN;
+        rate = 0;
+    }
+
+private:
+    float process_noise = 0.01f;
+    float measurement_noise = 0.25f;
+    float temperature = NAN;
+    float rate = 0;
+    float p00 = 0;
+    float p01 = 0;
+    float p11 = 0;
+    bool track_rate = false;
+    bool initialized = false;
+};
+
+/* ---------- Biquad Low-pass Filter ---------- */
+/**
+ * AD849xBiquad_7Semi
+ * - Second-order Butterworth low-pass (Q = 1/sqrt(2)).
+ * - setCutoffHz(fc, fs) designs the coefficients once (bilinear transform with
+ *   pre-warping); update() is then 4 multiplies and 7 adds per sample.
+ * - Runs the biquad as a trapezoidal state-variable filter: same transfer
+ *   function as direct form, but the states track the output instead of
+ *   cancelling large terms, so float stays accurate for fc << fs
+ *   (e.g. 0.1 Hz at 1 kHz).
+ * - Roll-off is 40 dB/decade versus 20 dB/decade for the EMA of
+ *   readFilteredTemperatureC(), so mains pickup (50/60 Hz) is attenuated far
+ *   more for the same low-frequency lag.
+ * - fs must be the real rate update() is called at (e.g. AD849xScheduler_7Semi).
+ *
+ * Example:
+ *   AD849xBiquad_7Semi lp;
+ *   lp.setCutoffHz(1.0f, 100.0f);
+ *   float smoothC = lp.update(thermo.readCelsius());
+ */
+class AD849xBiquad_7Semi
+{
+public:
+    /**
+     * setCutoffHz(fc, fs)
+     * - fc: -3 dB cutoff in Hz, 0 < fc < fs / 2.
+     * - fs: sample rate in Hz.
+     * - Resets the filter state.
+     */
+    void setCutoffHz(float fc, float fs)
+    {
+        float g = tanf(3.14159265f * fc / fs);
+
+        m1 = 1.0f / (1.0f + g * (g + 1.41421356f));
+        m2 = g * m1;
+        m3 = g * m2;
+
+        warped_cutoff = g;
+        sample_rate = fs;
+        reset();
+    }
+
+    /**
+     * update(x)
+     * - Filters one sample; the first sample after reset() pre-loads the
+     *   state so the output starts at x instead of ramping up from 0.
+     */
+    float update(float x)
+    {
+        if (!primed)
+        {
+            ic1 = 0;
+            ic2 = x;
+            primed = true;
+        }
+
+        float v3 = x - ic2;
+        float v1 = m1 * ic1 + m2 * v3;
+        float v2 = ic2 + m2 * ic1 + m3 * v3;
+
+        ic1 = 2.0f * v1 - ic1;
+        ic2 = 2.0f * v2 - ic2;
+
+        return v2;
+    }
+
+    void reset() { primed = false; }
+
+    /**
+     * responseDb(f)
+     * - Magnitude response in dB at frequency f (Hz) for the current design.
+     * - Bilinear Butterworth: |H|^2 = 1 / (1 + (tan(pi f / fs) / tan(pi fc / fs))^4)
+     */
+    float responseDb(float f)
+    {
+        float r = tanf(3.14159265f * f / sample_rate) / warped_cutoff;
+        float r2 = r * r;
+
+        return -10.0f * log10f(1.0f + r2 * r2);
+    }
+
+    /**
+     * design(fc, fs, c)
+     * - Direct-form Butterworth low-pass coefficients {b0, b1, b2, a1, a2} (a0 = 1)
+     *   of the same design, e.g. for an external DSP library:
+     *   K = tan(pi * fc / fs), n = 1 / (1 + sqrt(2) K + K^2)
+     *   b0 = b2 = K^2 n, b1 = 2 b0, a1 = 2 (K^2 - 1) n, a2 = (1 - sqrt(2) K + K^2) n
+     */
+    static void design(float fc, float fs, float c[5])
+    {
+        float k = tanf(3.14159265f * fc / fs);
+        float k2 = k * k;
+        float n = 1.0f / (1.0f + 1.41421356f * k + k2);
+
+        c[0] = k2 * n;
+        c[1] = 2.0f * c[0];
+        c[2] = c[0];
+        c[3] = 2.0f * (k2 - 1.0f) * n;
+        c[4] = (1.0f - 1.41421356f * k + k2) * n;
+    }
+
+private:
+    float warped_cutoff = 1;
+    float sample_rate = 1;
+    float m1 = 1;
+    float m2 = 0;
+    float m3 = 0;
+    float ic1 = 0;
+    float ic2 = 0;
+    bool primed = false;
+};
+
+/**
+ * AD849xBiquadFixed_7Semi
+ * - Integer-only version of AD849xBiquad_7Semi for FPU-less MCUs: the same
+ *   trapezoidal state-variable structure (bilinear Butterworth response),
+ *   with 32-bit states and no 64-bit arithmetic.
+ * - Coefficients g, k = sqrt(2) + g and 1 - 1 / (1 + g k) are stored as a
+ *   15-bit mantissa and a shift (block floating point), so a tiny g for
+ *   fc << fs keeps 15 significant bits, where a Q15 direct form would round
+ *   1 + a1 + a2 to zero.
+ * - Each coefficient multiply is two 16 x 16 -> 32 bit products; 4 per sample.
+ * - Each multiply feeds its truncation remainder into the next sample's
+ *   product (first-order error feedback), so the integrators see no
+ *   rounding bias: a constant input settles exactly (±1 count limit cycle
+ *   only for fc close to fs / 2).
+ * - States carry 6 fraction bits with 8x headroom for the internal peaks
+ *   (fc <= 0.45 fs); input: |x| < 2^22, e.g. readRaw() counts or
+ *   readMilliCelsius() (±4194 °C).
+ * - Only setCutoffHz() uses float math (once); update() is integer only.
+ *
+ * Example:
+ *   AD849xBiquadFixed_7Semi lp;
+ *   lp.setCutoffHz(1.0f, 100.0f);
+ *   int32_t smoothMilliC = lp.update(thermo.readMilliCelsius());
+ */
+class AD849xBiquadFixed_7Semi
+{
+public:
+    /**
+     * setCutoffHz(fc, fs)
+     * - fc: -3 dB cutoff in Hz, 0 < fc < fs / 2; fs: sample rate in Hz.
+     * - Resets the filter state.
+     */
+    void setCutoffHz(float fc, float fs)
+    {
+        float g = tanf(3.14159265f * fc / fs);
+        float k = 1.41421356f + g;
+
+        coefficient(g, g_m, g_s);
+        coefficient(k, k_m, k_s);
+        coefficient(g * k / (1.0f + g * k), d_m, d_s);
+
+        reset();
+    }
+
+    /**
+     * update(x)
+     * - Filters one sample; returns the output rounded to the input scale.
+     */
+    int32_t update(int32_t x)
+    {
+        int32_t in = x * (int32_t)(1L << FRAC);
+
+        if (!primed)
+        {
+            s1 = 0;
+            s2 = in;
+            e_k = e_d = e_1 = e_2 = 0;
+            primed = true;
+        }
+
+        int32_t u = in - s2 - mul(s1, k_m, k_s, e_k);
+        int32_t hp = u - mul(u, d_m, d_s, e_d);
+        int32_t v1 = mul(hp, g_m, g_s, e_1);
+        int32_t bp = v1 + s1;
+        s1 = bp + v1;
+
+        int32_t v2 = mul(bp, g_m, g_s, e_2);
+        int32_t lp = v2 + s2;
+        s2 = lp + v2;
+
+        return (lp + (1L << (FRAC - 1))) >> FRAC;
+    }
+
+    void reset() { primed = false; }
+
+private:
+    static const uint8_t FRAC = 6;
+
+    uint16_t g_m = 0;
+    uint16_t k_m = 0;
+    uint16_t d_m = 0;
+    uint8_t g_s = 16;
+    uint8_t k_s = 16;
+    uint8_t d_s = 16;
+    int32_t s1 = 0;
+    int32_t s2 = 0;
+    int32_t e_k = 0;
+    int32_t e_d = 0;
+    int32_t e_1 = 0;
+    int32_t e_2 = 0;
+    bool primed = false;
+
+    /**
+     * - c = m / 2^s with m in 0x4000 .. 0x7FFF.
+     */
+    static void coefficient(float c, uint16_t &m, uint8_t &s)
+    {
+        m = 0;
+        s = 16;
+        if (!(c > 0)) return;
+
+        s = 0;
+        while (c < 16384.0f && s < 46)
+        {
+            c *= 2.0f;
+            s++;
+        }
+
+        long r = lroundf(c);
+        if (r > 0x7FFF)
+        {
+            r >>= 1;
+            s--;
+        }
+        m = (uint16_t)r;
+    }
+
+    /**
+     * - floor((v * m + e) / 2^s) with v split into 16-bit halves, so both
+     *   products are 16 x 16 -> 32 bit; e is the remainder of the previous call.
+     */
+    static int32_t mul(int32_t v, uint16_t m, uint8_t s, int32_t &e)
+    {
+        int32_t hi = (int32_t)(int16_t)(v >> 16) * (int32_t)m;
+        uint32_t lo = (uint32_t)(uint16_t)v * m;
+
+        if (s >= 16)
+        {
+            uint8_t sh = s - 16;
+            int32_t t = hi + (int32_t)(lo >> 16) + e;
+            int32_t r = t >> sh;
+            e = t - r * (int32_t)(1L << sh);
+            return r;
+        }
+
+        lo += (uint32_t)e;
+        e = (int32_t)(lo & ((1UL << s) - 1));
+        return hi * (int32_t)(1L << (16 - s)) + (int32_t)(lo >> s);
+    }
+};
+
+/* ---------- CIC Decimator ---------- */
+/**
+ * AD849xCIC_7Semi
+ * - Cascaded integrator-comb decimator: order N (1 .. 4) integrators at the
+ *   input rate, N combs at the output rate (1 / ratio).
+ * - Integer adds and subtracts only, no sample storage, no multiplies:
+ *   safe to run inside an ADC ISR at tens of kS/s.
+ * - Registers are uint32_t, sized to the real bit growth: wrap-around is
+ *   harmless as long as the output fits, so configure() requires
+ *   inputBits + N * ceil(log2(ratio)) <= 32
+ *   (10-bit ADC: N = 2 up to ratio 2048, N = 3 up to ratio 128).
+ * - ISR cost per sample: N 32-bit load / add / store (about 20 AVR cycles
+ *   each by instruction count), plus the combs once per output.
+ * - DC gain is ratio^N; read() removes it with a shift when ratio is a
+ *   power of two, otherwise with a 32-bit division per output.
+ * - The first N outputs after configure() / reset() are suppressed
+ *   (comb start-up transient).
+ * - Use it through AD849x_7Semi::setDecimator() so pushSample() feeds it
+ *   and readRaw() returns its output, or standalone with push() / read().
+ *
+ * Example (AVR free-running ADC at ~9.6 kS/s -> ~9.4 Hz):
+ *   AD849xCIC_7Semi cic;
+ *   cic.configure(2, 1024);
+ *   thermo.setDecimator(&cic);
+ *   ISR(ADC_vect) { thermo.pushSample(ADC); }
+ */
+class AD849xCIC_7Semi
+{
+public:
+    /**
+     * configure(order, ratio, inputBits)
+     * - order: 1 .. 4 (higher order = steeper alias rejection).
+     * - ratio: input samples per output, 1 .. 2^31.
+     * - inputBits: width of the pushed samples, 1 .. 16 (10 for AVR,
+     *   12 for most 32-bit MCUs).
+     * - Returns false (configuration unchanged) if out of range or if
+     *   inputBits + order * ceil(log2(ratio)) exceeds 32 bits.
+     * - Call before the ISR starts feeding push().
+     */
+    bool configure(uint8_t order, uint32_t ratio, uint8_t inputBits = 10)
+    {
+        if (order < 1 || order > 4 || ratio < 1 || ratio > 0x80000000UL) return false;
+        if (inputBits < 1 || inputBits > 16) return false;
+
+        uint8_t bits = 0;                        // ceil(log2(ratio)), 0 .. 31
+        while (((uint32_t)1 << bits) < ratio) bits++;
+        if (inputBits + order * bits > 32) return false;
+
+        cic_order = order;
+        cic_ratio = ratio;
+        input_bits = inputBits;
+        pow2_shift = (((uint32_t)1 << bits) == ratio) ? order * bits : 0xFF;
+
+        cic_gain = 1;
+        for (uint8_t i = 0; i < order; i++)
+        {
+            cic_gain *= ratio;
+        }
+
+        reset();
+        return true;
+    }
+
+    /**
+     * push(sample)
+     * - Runs the integrators; every ratio-th call also runs the combs.
+     * - Returns true when a new output is available.
+     */
+    bool push(uint16_t sample)
+    {
+        uint32_t acc = sample;
+
+        for (uint8_t i = 0; i < cic_order; i++)
+        {
+            integrator[i] += acc;
+            acc = integrator[i];
+        }
+
+        if (++phase < cic_ratio) return false;
+        phase = 0;
+
+        for (uint8_t i = 0; i < cic_order; i++)
+        {
+            uint32_t in = acc;
+            acc -= comb[i];
+            comb[i] = in;
+        }
+
+        out = acc;
+
+        if (settle)
+        {
+            settle--;
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * read(extraBits)
+     * - Last output as the mean input value with extraBits fractional bits
+     *   (0 = native ADC counts), rounded to nearest.
+     */
+    uint32_t read(uint8_t extraBits = 0) { return normalize(out, extraBits); }
+
+    /**
+     * normalize(output, extraBits)
+     * - Removes the ratio^order gain from a rawOutput() value: a shift for
+     *   power-of-two ratios, otherwise one 32-bit division plus extraBits
+     *   shift-and-subtract steps for the fraction.
+     * - Lets an ISR latch rawOutput() and leave the division to thread context.
+     */
+    uint32_t normalize(uint32_t v, uint8_t extraBits)
+    {
+        if (pow2_shift != 0xFF)
+        {
+            if (pow2_shift <= extraBits) return v << (extraBits - pow2_shift);
+            uint8_t s = pow2_shift - extraBits;
+            return (v >> s) + ((v >> (s - 1)) & 1);
+        }
+
+        uint32_t whole = v / cic_gain;
+        uint32_t rem = v - whole * cic_gain;     // < cic_gain <= 2^31
+
+        for (uint8_t i = 0; i < extraBits; i++)
+        {
+            whole <<= 1;
+            rem <<= 1;
+            if (rem >= cic_gain)
+            {
+                rem -= cic_gain;
+                whole |= 1;
+            }
+        }
+
+        return whole + ((rem << 1) >= cic_gain ? 1 : 0);
+    }
+
+    /**
+     * rawOutput()
+     * - Last comb output before gain removal (ratio^order * mean input).
+     */
+    uint32_t rawOutput() { return out; }
+
+    uint8_t getOrder() { return cic_order; }
+    uint32_t getRatio() { return cic_ratio; }
+    uint32_t getGain() { return cic_gain; }
+    uint8_t getInputBits() { return input_bits; }
+
+    /**
+     * reset()
+     * - Clears integrators, combs and phase; restarts the start-up suppression.
+     */
+    void reset()
+    {
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            integrator[i] = 0;
+            comb[i] = 0;
+        }
+
+        out = 0;
+        phase = 0;
+        settle = cic_order;
+    }
+
+private:
+    uint32_t integrator[4] = {0, 0, 0, 0};
+    uint32_t comb[4] = {0, 0, 0, 0};
+    uint32_t out = 0;
+    uint32_t cic_gain = 1;
+    uint32_t cic_ratio = 1;
+    uint32_t phase = 0;
+    uint8_t cic_order = 1;
+    uint8_t input_bits = 10;
+    uint8_t pow2_shift = 0;
+    uint8_t settle = 1;
+};
+
+/* ---------- Mock ADC Backend ---------- */
+/**
+ * AD849xMockADC_7Semi
+ * - Simulated ADC for host builds and regression tests.
+ * - Returns a constant value, or replays a caller-owned sample sequence cyclically.
+ * - Route the ADC hook to it: uint16_t ad849xReadADC(uint8_t pin) { return mock.read(pin); }
+ */
+class AD849xMockADC_7Semi
+{
+public:
+    /**
+     * setValue(value)
+     * - Every conversion returns `value`.
+     */
+    void setValue(uint16_t value)
+    {
+        constant = value;
+        sequence = nullptr;
+        length = 0;
+        position = 0;
+    }
+
+    /**
+     * setSequence(samples, count)
+     * - Conversions return samples[0], samples[1], ... and wrap around.
+     * - The array is not copied; it must outlive the mock.
+     */
+    void setSequence(const uint16_t *samples, size_t count)
+    {
+        sequence = samples;
+        length = count;
+        position = 0;
+    }
+
+    /**
+     * reads()
+     * - Number of conversions served since construction / resetReads().
+     */
+    uint32_t reads() { return read_count; }
+    void resetReads() { read_count = 0; }
+
+    /**
+     * read(pin)
+     * - Serves one conversion (same for every pin).
+     */
+    uint16_t read(uint8_t pin)
+    {
+        (void)pin;
+        read_count++;
+
+        if (!sequence || length == 0) return constant;
+
+        uint16_t value = sequence[position];
+        if (++position >= length) position = 0;
+        return value;
+    }
+
+private:
+    uint16_t constant = 0;
+    const uint16_t *sequence = nullptr;
+    size_t length = 0;
+    size_t position = 0;
+    uint32_t read_count = 0;
 };
 #endif
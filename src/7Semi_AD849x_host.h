@@ -0,0 +1,44 @@
+/**
+ * 7Semi AD849x Host Build Shims
+ *
+ * - Minimal stand-ins for the Arduino core so the library builds on a PC
+ *   (Linux / macOS) for benchmarks and regression tests.
+ * - Only included when AD849X_HOST_BUILD is defined (extras/tests/Makefile
+ *   does); every other build needs a real <Arduino.h>.
+ * - There is no real ADC: analogRead() returns 0. Define ad849xReadADC()
+ *   (e.g. around AD849xMockADC_7Semi) or feed pushSample().
+ * - noInterrupts()/interrupts() are no-ops: simulate ISRs from the same thread.
+ */
+
+#pragma once
+
+#ifndef _7SEMI_AD849X_HOST_H_
+#define _7SEMI_AD849X_HOST_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include <chrono>
+
+#ifndef INPUT
+#define INPUT 0x0
+#endif
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline int analogRead(uint8_t) { return 0; }
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+inline unsigned long micros()
+{
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start).count();
+}
+
+inline unsigned long millis()
+{
+    return micros() / 1000UL;
+}
+
+#endif